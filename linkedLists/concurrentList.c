@@ -0,0 +1,464 @@
+/******************************************************************************
+ *                      LOCK-FREE CONCURRENT LISTS                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "concurrentList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/******************************************************************************
+ * HAZARD POINTERS                                                            *
+ ******************************************************************************
+ * Every thread owns a record with two hazard slots and the list of nodes it  *
+ * has removed (retired). When there are enough retired nodes, the record is  *
+ * scanned, and the nodes that no hazard slot points to are freed.            *
+ ******************************************************************************/
+#define HAZARDS_PER_THREAD 2
+#define HAZARD_SLOTS       (CONCURRENT_LIST_MAX_THREADS * HAZARDS_PER_THREAD)
+#define RETIRE_THRESHOLD   (2 * HAZARD_SLOTS)
+
+typedef struct hazardRecord
+{
+    _Alignas(64) _Atomic(concurrentListNode_t*) hazard[HAZARDS_PER_THREAD];
+    atomic_int                                  active;
+    concurrentListNode_t                      **retired;
+    natural                                     retiredCount;
+    natural                                     retiredCapacity;
+
+} hazardRecord_t;
+
+static hazardRecord_t hazardRecords[CONCURRENT_LIST_MAX_THREADS];
+static pthread_once_t hazardOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t  hazardKey;
+static _Thread_local hazardRecord_t *hazardSelf = NULL;
+
+/*Gives the record back when its thread exits. The retired nodes stay in the 
+  record, to be scanned by the next thread that takes it.*/
+static void hazardRelease(void *record)
+{
+    hazardRecord_t *self = (hazardRecord_t*) record;
+    register natural i;
+
+    for(i = 0; i < HAZARDS_PER_THREAD; i++) 
+    {
+        atomic_store(&self->hazard[i], NULL);
+    }
+    atomic_store(&self->active, 0);
+}
+
+static void hazardKeyCreate(void)
+{
+    pthread_key_create(&hazardKey, hazardRelease);
+}
+
+static hazardRecord_t *hazardAcquire(void)
+{
+    register natural i;
+
+    if (hazardSelf != NULL) return hazardSelf;
+
+    pthread_once(&hazardOnce, hazardKeyCreate);
+    for(i = 0; i < CONCURRENT_LIST_MAX_THREADS; i++)
+    {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&hazardRecords[i].active, 
+                                           &expected, 1))
+        {
+            hazardSelf = &hazardRecords[i];
+            pthread_setspecific(hazardKey, hazardSelf);
+            return hazardSelf;
+        }
+    }
+
+    printf("ERROR::more than %d threads on concurrent lists\n", 
+           CONCURRENT_LIST_MAX_THREADS);
+    abort();
+}
+
+/*Announces the node read from source. The announcement only counts if the 
+  source still points to the node afterwards, since the node could have been
+  removed (and scanned) in between.*/
+static concurrentListNode_t *hazardProtect(hazardRecord_t *self, int slot,
+                                           _Atomic(concurrentListNode_t*) *source)
+{
+    concurrentListNode_t *node = atomic_load(source);
+    concurrentListNode_t *announced;
+
+    do
+    {
+        announced = node;
+        atomic_store(&self->hazard[slot], announced);
+        node = atomic_load(source);
+    } while(node != announced);
+
+    return node;
+}
+
+static void hazardClear(hazardRecord_t *self)
+{
+    register natural i;
+
+    for(i = 0; i < HAZARDS_PER_THREAD; i++) 
+    {
+        atomic_store_explicit(&self->hazard[i], NULL, memory_order_release);
+    }
+}
+
+static int hazardCompare(const void *first, const void *second)
+{
+    uintptr_t a = (uintptr_t) *(concurrentListNode_t* const*) first;
+    uintptr_t b = (uintptr_t) *(concurrentListNode_t* const*) second;
+
+    return (a > b) - (a < b);
+}
+
+/*Frees the retired nodes of the record that no thread announces*/
+static void hazardScan(hazardRecord_t *self)
+{
+    concurrentListNode_t *announced[HAZARD_SLOTS];
+    natural count = 0, kept = 0;
+    register natural i, j;
+
+    for(i = 0; i < CONCURRENT_LIST_MAX_THREADS; i++)
+    {
+        for(j = 0; j < HAZARDS_PER_THREAD; j++)
+        {
+            concurrentListNode_t *node = 
+                atomic_load(&hazardRecords[i].hazard[j]);
+            if (node != NULL) announced[count++] = node;
+        }
+    }
+    qsort(announced, count, sizeof(concurrentListNode_t*), hazardCompare);
+
+    for(i = 0; i < self->retiredCount; i++)
+    {
+        concurrentListNode_t *node = self->retired[i];
+        if (bsearch(&node, announced, count, sizeof(concurrentListNode_t*), 
+                    hazardCompare) != NULL)
+        {
+            self->retired[kept++] = node;
+        }
+        else
+        {
+            free(node);
+        }
+    }
+    self->retiredCount = kept;
+}
+
+static void hazardRetire(hazardRecord_t *self, concurrentListNode_t *node)
+{
+    if (self->retiredCount == self->retiredCapacity)
+    {
+        natural capacity = (self->retiredCapacity > 0) 
+                         ? 2 * self->retiredCapacity : RETIRE_THRESHOLD;
+        concurrentListNode_t **retired = (concurrentListNode_t**) realloc(
+            self->retired, capacity * sizeof(concurrentListNode_t*));
+        if (retired == NULL)
+        {
+            printf("ERROR::out of memory\n");
+            abort();
+        }
+        self->retired = retired;
+        self->retiredCapacity = capacity;
+    }
+
+    self->retired[self->retiredCount++] = node;
+    if (self->retiredCount >= RETIRE_THRESHOLD) hazardScan(self);
+}
+
+static concurrentListNode_t *concurrentListNodeNew(real data)
+{
+    concurrentListNode_t *node = 
+        (concurrentListNode_t*) malloc(sizeof(concurrentListNode_t));
+    if (node == NULL)
+    {
+        printf("ERROR::out of memory\n");
+        abort();
+    }
+    node->data = data;
+    atomic_init(&node->next, NULL);
+
+    return node;
+}
+
+/*Frees a chain of nodes, which no other thread may be using*/
+static void concurrentListChainFree(concurrentListNode_t *node)
+{
+    concurrentListNode_t *nextNode;
+
+    while(node != NULL)
+    {
+        nextNode = atomic_load_explicit(&node->next, memory_order_relaxed);
+        free(node);
+        node = nextNode;
+    }
+}
+
+/******************************************************************************
+ * concurrentQueueInit                                                        *
+ ******************************************************************************
+ * description: initializes an empty queue, which holds only a dummy node.    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentQueue_t *queue : receives the queue address (&queue).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : an empty queue.                            *
+ ******************************************************************************/
+void concurrentQueueInit(concurrentQueue_t *queue)
+{
+    concurrentListNode_t *dummy = concurrentListNodeNew(0);
+
+    atomic_init(&queue->head, dummy);
+    atomic_init(&queue->tail, dummy);
+}
+
+/******************************************************************************
+ * concurrentQueueDestroy                                                     *
+ ******************************************************************************
+ * description: frees every node of the queue. No other thread may be using   *
+ *              the queue.                                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentQueue_t *queue : receives the queue address (&queue).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : a queue without memory.                    *
+ ******************************************************************************/
+void concurrentQueueDestroy(concurrentQueue_t *queue)
+{
+    concurrentListChainFree(atomic_load(&queue->head));
+
+    atomic_store(&queue->head, NULL);
+    atomic_store(&queue->tail, NULL);
+}
+
+/******************************************************************************
+ * concurrentQueueEnqueue                                                     *
+ ******************************************************************************
+ * description: adds a new node at the end of the queue. The node is linked   *
+ *              after the last node with a CAS, and the tail is then moved    *
+ *              (by this thread, or by any other that finds it behind).       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentQueue_t *queue : receives the queue address (&queue).       *
+ *      real               data  : a double data value.                       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : a new node at the end of the queue.        *
+ ******************************************************************************/
+void concurrentQueueEnqueue(concurrentQueue_t *queue, real data)
+{
+    hazardRecord_t *self = hazardAcquire();
+    concurrentListNode_t *node = concurrentListNodeNew(data);
+    concurrentListNode_t *tail, *nextNode;
+
+    while(1)
+    {
+        tail = hazardProtect(self, 0, &queue->tail);
+        nextNode = atomic_load(&tail->next);
+
+        if (tail != atomic_load(&queue->tail)) continue;
+
+        /*the tail is behind: helping to move it*/
+        if (nextNode != NULL)
+        {
+            atomic_compare_exchange_weak(&queue->tail, &tail, nextNode);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak(&tail->next, &nextNode, node))
+        {
+            atomic_compare_exchange_strong(&queue->tail, &tail, node);
+            break;
+        }
+    }
+
+    hazardClear(self);
+}
+
+/******************************************************************************
+ * concurrentQueueDequeue                                                     *
+ ******************************************************************************
+ * description: removes the first node of the queue. The node after the      *
+ *              dummy holds the data, and becomes the new dummy; the old      *
+ *              dummy is retired.                                             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentQueue_t *queue : receives the queue address (&queue).       *
+ *      real              *data  : receives the data of the removed node.     *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                      : 1 if a node was removed, 0 if the queue    *
+ *                                 is empty.                                  *
+ ******************************************************************************/
+int concurrentQueueDequeue(concurrentQueue_t *queue, real *data)
+{
+    hazardRecord_t *self = hazardAcquire();
+    concurrentListNode_t *head, *tail, *nextNode;
+
+    while(1)
+    {
+        head = hazardProtect(self, 0, &queue->head);
+        tail = atomic_load(&queue->tail);
+        nextNode = hazardProtect(self, 1, &head->next);
+
+        if (head != atomic_load(&queue->head)) continue;
+
+        if (nextNode == NULL)
+        {
+            hazardClear(self);
+            return 0;
+        }
+
+        /*the tail is behind: helping to move it before removing*/
+        if (head == tail)
+        {
+            atomic_compare_exchange_weak(&queue->tail, &tail, nextNode);
+            continue;
+        }
+
+        *data = nextNode->data;
+        if (atomic_compare_exchange_weak(&queue->head, &head, nextNode)) break;
+    }
+
+    hazardClear(self);
+    hazardRetire(self, head);
+
+    return 1;
+}
+
+/******************************************************************************
+ * concurrentStackInit                                                        *
+ ******************************************************************************
+ * description: initializes an empty stack.                                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentStack_t *stack : receives the stack address (&stack).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : an empty stack.                            *
+ ******************************************************************************/
+void concurrentStackInit(concurrentStack_t *stack)
+{
+    atomic_init(&stack->top, NULL);
+}
+
+/******************************************************************************
+ * concurrentStackDestroy                                                     *
+ ******************************************************************************
+ * description: frees every node of the stack. No other thread may be using   *
+ *              the stack.                                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentStack_t *stack : receives the stack address (&stack).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : an empty stack.                            *
+ ******************************************************************************/
+void concurrentStackDestroy(concurrentStack_t *stack)
+{
+    concurrentListChainFree(atomic_load(&stack->top));
+
+    atomic_store(&stack->top, NULL);
+}
+
+/******************************************************************************
+ * concurrentStackPush                                                        *
+ ******************************************************************************
+ * description: adds a new node at the top of the stack.                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentStack_t *stack : receives the stack address (&stack).       *
+ *      real               data  : a double data value.                       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : a new node at the top of the stack.        *
+ ******************************************************************************/
+void concurrentStackPush(concurrentStack_t *stack, real data)
+{
+    concurrentListNode_t *node = concurrentListNodeNew(data);
+    concurrentListNode_t *top = atomic_load(&stack->top);
+
+    do
+    {
+        atomic_store_explicit(&node->next, top, memory_order_relaxed);
+    } while(!atomic_compare_exchange_weak(&stack->top, &top, node));
+}
+
+/******************************************************************************
+ * concurrentStackPop                                                         *
+ ******************************************************************************
+ * description: removes the node at the top of the stack. The top is          *
+ *              announced before its next pointer is read, so it cannot be    *
+ *              freed and reused in between (no ABA).                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      concurrentStack_t *stack : receives the stack address (&stack).       *
+ *      real              *data  : receives the data of the removed node.     *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                      : 1 if a node was removed, 0 if the stack    *
+ *                                 is empty.                                  *
+ ******************************************************************************/
+int concurrentStackPop(concurrentStack_t *stack, real *data)
+{
+    hazardRecord_t *self = hazardAcquire();
+    concurrentListNode_t *top, *nextNode;
+
+    while(1)
+    {
+        top = hazardProtect(self, 0, &stack->top);
+        if (top == NULL)
+        {
+            hazardClear(self);
+            return 0;
+        }
+
+        nextNode = atomic_load(&top->next);
+        if (atomic_compare_exchange_weak(&stack->top, &top, nextNode)) break;
+    }
+
+    *data = top->data;
+    hazardClear(self);
+    hazardRetire(self, top);
+
+    return 1;
+}
+
+/******************************************************************************
+ * concurrentListReclaim                                                      *
+ ******************************************************************************
+ * description: frees every retired node, announced or not. It must only be   *
+ *              called when no other thread is using the concurrent lists     *
+ *              (e.g., after the workers are joined).                         *
+ ******************************************************************************
+ * output:                                                                    *
+ *      void                     : no retired node left.                      *
+ ******************************************************************************/
+void concurrentListReclaim(void)
+{
+    register natural i, j;
+
+    for(i = 0; i < CONCURRENT_LIST_MAX_THREADS; i++)
+    {
+        hazardRecord_t *record = &hazardRecords[i];
+
+        for(j = 0; j < record->retiredCount; j++) free(record->retired[j]);
+        free(record->retired);
+
+        record->retired         = NULL;
+        record->retiredCount    = 0;
+        record->retiredCapacity = 0;
+    }
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                      LOCK-FREE CONCURRENT LISTS                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * Lock-free lists over nodes that carry a real, as linkedList_t does, but    *
+ * whose next pointer is a C11 atomic:                                        *
+ *                                                                            *
+ *  - concurrentQueue_t is the Michael-Scott multi-producer multi-consumer    *
+ *    FIFO queue, with a dummy head node.                                     *
+ *  - concurrentStack_t is the Treiber LIFO stack.                            *
+ *                                                                            *
+ * Removed nodes are reclaimed with hazard pointers: a thread announces the   *
+ * nodes it is about to read, and a removed node is only freed when no thread *
+ * announces it. Thus, there is no use-after-free, and a node cannot be freed *
+ * and reused while a thread still compares against it (no ABA).              *
+ *                                                                            *
+ * Each thread takes a hazard record on its first operation, which is given   *
+ * back automatically when the thread exits. At most                          *
+ * CONCURRENT_LIST_MAX_THREADS threads may use the lists at the same time.    *
+ * Destroying a list, and concurrentListReclaim, must only be done when no    *
+ * other thread is using the lists.                                           *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __CONCURRENT_LIST_H__
+#define __CONCURRENT_LIST_H__
+
+#include "linkedList.h"
+
+#include <stdatomic.h>
+
+#define CONCURRENT_LIST_MAX_THREADS 128
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct concurrentListNode
+{
+    real                                data;
+    _Atomic(struct concurrentListNode*) next;
+
+} concurrentListNode_t;
+
+typedef struct concurrentQueue
+{
+    /*head and tail on different cache lines, producers and consumers do not
+      share them*/
+    _Alignas(64) _Atomic(concurrentListNode_t*) head;
+    _Alignas(64) _Atomic(concurrentListNode_t*) tail;
+
+} concurrentQueue_t;
+
+typedef struct concurrentStack
+{
+    _Atomic(concurrentListNode_t*) top;
+
+} concurrentStack_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void concurrentQueueInit(concurrentQueue_t *queue);
+void concurrentQueueDestroy(concurrentQueue_t *queue);
+void concurrentQueueEnqueue(concurrentQueue_t *queue, real data);
+int concurrentQueueDequeue(concurrentQueue_t *queue, real *data);
+
+void concurrentStackInit(concurrentStack_t *stack);
+void concurrentStackDestroy(concurrentStack_t *stack);
+void concurrentStackPush(concurrentStack_t *stack, real data);
+int concurrentStackPop(concurrentStack_t *stack, real *data);
+
+void concurrentListReclaim(void);
+
+#endif
+/*****END*****/
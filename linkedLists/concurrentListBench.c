@@ -0,0 +1,297 @@
+/******************************************************************************
+ *                      LOCK-FREE CONCURRENT LISTS                            *
+ *                       STRESS TEST AND BENCHMARK                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: concurrentListBench [threads] [operations per thread]               *
+ *                                                                            *
+ * First, producers and consumers hammer the lock-free queue and stack, and   *
+ * every value is checked to be removed exactly once (and, for the queue, in  *
+ * the order each producer added them). The exit code is 1 on any failure.   *
+ *                                                                            *
+ * Then, every thread runs enqueue/dequeue pairs on a shared queue, and the   *
+ * throughput of the lock-free queue is compared with the one of a list       *
+ * handle (linkedListHandleAppend / linkedListHandlePopFront) serialized by a *
+ * mutex.                                                                     *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "concurrentList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+typedef struct stressShared
+{
+    concurrentQueue_t queue;
+    concurrentStack_t stack;
+    natural           producers;
+    natural           operations;
+    atomic_uint       consumed;
+    atomic_uchar     *seen;
+    atomic_int        failures;
+
+} stressShared_t;
+
+typedef struct stressWorker
+{
+    stressShared_t *shared;
+    natural         id;
+
+} stressWorker_t;
+
+static double benchNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*Each value tells its producer and its sequence number*/
+static void stressMark(stressShared_t *shared, real data)
+{
+    natural value = (natural) data;
+
+    if (value >= shared->producers * shared->operations ||
+        atomic_exchange(&shared->seen[value], 1) != 0)
+    {
+        atomic_fetch_add(&shared->failures, 1);
+    }
+    atomic_fetch_add(&shared->consumed, 1);
+}
+
+static void *stressQueueProducer(void *argument)
+{
+    stressWorker_t *worker = (stressWorker_t*) argument;
+    stressShared_t *shared = worker->shared;
+    register natural i;
+
+    for(i = 0; i < shared->operations; i++)
+    {
+        concurrentQueueEnqueue(&shared->queue, 
+                               worker->id * shared->operations + i);
+    }
+
+    return NULL;
+}
+
+static void *stressQueueConsumer(void *argument)
+{
+    stressWorker_t *worker = (stressWorker_t*) argument;
+    stressShared_t *shared = worker->shared;
+    natural total = shared->producers * shared->operations;
+    long *last = (long*) malloc(shared->producers * sizeof(long));
+    real data;
+    register natural i;
+
+    for(i = 0; i < shared->producers; i++) last[i] = -1;
+
+    while(atomic_load(&shared->consumed) < total)
+    {
+        if (!concurrentQueueDequeue(&shared->queue, &data)) continue;
+
+        /*the values of a producer must come out in the order they came in*/
+        natural producer = (natural) data / shared->operations;
+        long sequence = (long) ((natural) data % shared->operations);
+        if (producer < shared->producers)
+        {
+            if (sequence <= last[producer]) 
+            {
+                atomic_fetch_add(&shared->failures, 1);
+            }
+            last[producer] = sequence;
+        }
+        stressMark(shared, data);
+    }
+
+    free(last);
+    return NULL;
+}
+
+static void *stressStackWorker(void *argument)
+{
+    stressWorker_t *worker = (stressWorker_t*) argument;
+    stressShared_t *shared = worker->shared;
+    natural total = shared->producers * shared->operations;
+    natural pushed = 0;
+    real data;
+
+    /*pushing and popping at the same time, until every value is popped*/
+    while(atomic_load(&shared->consumed) < total)
+    {
+        if (pushed < shared->operations)
+        {
+            concurrentStackPush(&shared->stack, 
+                                worker->id * shared->operations + pushed++);
+        }
+        if (concurrentStackPop(&shared->stack, &data)) 
+        {
+            stressMark(shared, data);
+        }
+    }
+
+    return NULL;
+}
+
+static int stressRun(const char *name, natural threads, natural operations, 
+                     int queue)
+{
+    stressShared_t shared;
+    pthread_t *ids = (pthread_t*) malloc(2 * threads * sizeof(pthread_t));
+    stressWorker_t *workers = 
+        (stressWorker_t*) malloc(2 * threads * sizeof(stressWorker_t));
+    natural total = threads * operations;
+    natural count = 0;
+    register natural i;
+
+    concurrentQueueInit(&shared.queue);
+    concurrentStackInit(&shared.stack);
+    shared.producers  = threads;
+    shared.operations = operations;
+    shared.seen       = (atomic_uchar*) calloc(total, sizeof(atomic_uchar));
+    atomic_init(&shared.consumed, 0);
+    atomic_init(&shared.failures, 0);
+
+    for(i = 0; i < threads; i++)
+    {
+        workers[i].shared = &shared;
+        workers[i].id     = i;
+        pthread_create(&ids[count++], NULL, 
+                       queue ? stressQueueProducer : stressStackWorker, 
+                       &workers[i]);
+    }
+    if (queue)
+    {
+        for(i = 0; i < threads; i++)
+        {
+            workers[threads + i].shared = &shared;
+            workers[threads + i].id     = i;
+            pthread_create(&ids[count++], NULL, stressQueueConsumer, 
+                           &workers[threads + i]);
+        }
+    }
+    for(i = 0; i < count; i++) pthread_join(ids[i], NULL);
+
+    /*every value must have been seen exactly once*/
+    for(i = 0; i < total; i++)
+    {
+        if (atomic_load(&shared.seen[i]) != 1) 
+        {
+            atomic_fetch_add(&shared.failures, 1);
+        }
+    }
+
+    int failures = atomic_load(&shared.failures);
+    printf("concurrentList::stress::%s::[ threads %d values %d failures %d ]\n",
+           name, count, total, failures);
+
+    concurrentQueueDestroy(&shared.queue);
+    concurrentStackDestroy(&shared.stack);
+    concurrentListReclaim();
+    free((void*) shared.seen);
+    free(workers);
+    free(ids);
+
+    return failures == 0;
+}
+
+typedef struct benchShared
+{
+    concurrentQueue_t  queue;
+    linkedListHandle_t handle;
+    pthread_mutex_t    mutex;
+    natural            operations;
+    int                lockFree;
+
+} benchShared_t;
+
+static void *benchWorker(void *argument)
+{
+    benchShared_t *shared = (benchShared_t*) argument;
+    real data;
+    register natural i;
+
+    for(i = 0; i < shared->operations; i++)
+    {
+        if (shared->lockFree)
+        {
+            concurrentQueueEnqueue(&shared->queue, i);
+            concurrentQueueDequeue(&shared->queue, &data);
+        }
+        else
+        {
+            pthread_mutex_lock(&shared->mutex);
+            linkedListHandleAppend(&shared->handle, i);
+            pthread_mutex_unlock(&shared->mutex);
+
+            pthread_mutex_lock(&shared->mutex);
+            if (linkedListHandleSize(&shared->handle) > 0)
+            {
+                linkedListHandlePopFront(&shared->handle);
+            }
+            pthread_mutex_unlock(&shared->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+static double benchRun(natural threads, natural operations, int lockFree)
+{
+    benchShared_t shared;
+    pthread_t *ids = (pthread_t*) malloc(threads * sizeof(pthread_t));
+    register natural i;
+
+    concurrentQueueInit(&shared.queue);
+    linkedListHandleInit(&shared.handle);
+    pthread_mutex_init(&shared.mutex, NULL);
+    shared.operations = operations;
+    shared.lockFree   = lockFree;
+
+    double start = benchNow();
+    for(i = 0; i < threads; i++) 
+    {
+        pthread_create(&ids[i], NULL, benchWorker, &shared);
+    }
+    for(i = 0; i < threads; i++) pthread_join(ids[i], NULL);
+    double elapsed = benchNow() - start;
+
+    concurrentQueueDestroy(&shared.queue);
+    concurrentListReclaim();
+    linkedListHandleFree(&shared.handle);
+    pthread_mutex_destroy(&shared.mutex);
+    free(ids);
+
+    /*millions of operations (enqueue or dequeue) per second*/
+    return 2.0 * threads * operations / elapsed / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    natural threads    = (argc > 1) ? (natural) atoi(argv[1]) : 4;
+    natural operations = (argc > 2) ? (natural) atoi(argv[2]) : 200000;
+    int passed = 1;
+
+    if (threads == 0 || 2 * threads > CONCURRENT_LIST_MAX_THREADS) threads = 4;
+
+    passed &= stressRun("queue", threads, operations, 1);
+    passed &= stressRun("stack", threads, operations, 0);
+
+    double mutex    = benchRun(threads, operations, 0);
+    double lockFree = benchRun(threads, operations, 1);
+    printf("concurrentList::bench::mutex::[ threads %d Mops/s %.2f ]\n", 
+           threads, mutex);
+    printf("concurrentList::bench::lockFree::[ threads %d Mops/s %.2f ]\n", 
+           threads, lockFree);
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,362 @@
+/******************************************************************************
+ *                          DOUBLY LINKED LISTS                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "doublyList.h"
+
+#include <stdio.h>
+
+/*Nodes carved from each chunk of the pool*/
+#define DOUBLY_LIST_CHUNK 1024
+
+/******************************************************************************
+ * doublyListInit                                                             *
+ ******************************************************************************
+ * description: initializes an empty list, holding only its sentinels.        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void doublyListInit(doublyList_t *list)
+{
+    linkedListPoolInitSized(&list->pool, sizeof(doublyListNode_t),
+                            DOUBLY_LIST_CHUNK);
+
+    list->head = (doublyListNode_t*) linkedListPoolAlloc(&list->pool);
+    list->tail = (doublyListNode_t*) linkedListPoolAlloc(&list->pool);
+
+    list->head->data     = 0;
+    list->head->previous = NULL;
+    list->head->next     = list->tail;
+    list->tail->data     = 0;
+    list->tail->previous = list->head;
+    list->tail->next     = NULL;
+    list->size = 0;
+}
+
+/******************************************************************************
+ * doublyListFree                                                             *
+ ******************************************************************************
+ * description: frees every node of the list, sentinels included, by giving   *
+ *              its pool back at once. The list must be initialized again to  *
+ *              be reused.                                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a released list.                              *
+ ******************************************************************************/
+void doublyListFree(doublyList_t *list)
+{
+    linkedListPoolDestroy(&list->pool);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/******************************************************************************
+ * doublyListSize                                                             *
+ ******************************************************************************
+ * description: returns the number of values in the list.                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural               : number of values in the list.                 *
+ ******************************************************************************/
+natural doublyListSize(const doublyList_t *list)
+{
+    return list->size;
+}
+
+/******************************************************************************
+ * doublyListAddBegin                                                         *
+ ******************************************************************************
+ * description: adds a new node at the beginning of the list, in O(1).        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the beginning of the list.      *
+ ******************************************************************************/
+void doublyListAddBegin(doublyList_t *list, real data)
+{
+    doublyListInsertBefore(list, list->head->next, data);
+}
+
+/******************************************************************************
+ * doublyListAddEnd                                                           *
+ ******************************************************************************
+ * description: adds a new node at the end of the list, in O(1).              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the end of the list.            *
+ ******************************************************************************/
+void doublyListAddEnd(doublyList_t *list, real data)
+{
+    doublyListInsertBefore(list, list->tail, data);
+}
+
+/******************************************************************************
+ * doublyListAddByIndex                                                       *
+ ******************************************************************************
+ * description: adds a new node at some specific position of the list. An    *
+ *              index beyond the last position appends the node.              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : unsigned int index value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the desired position.           *
+ ******************************************************************************/
+void doublyListAddByIndex(doublyList_t *list, real data, natural index)
+{
+    doublyListNode_t *node = (index >= list->size) ? list->tail
+                                                   : doublyListNodeAt(list, index);
+
+    doublyListInsertBefore(list, node, data);
+}
+
+/******************************************************************************
+ * doublyListRemoveLast                                                       *
+ ******************************************************************************
+ * description: removes the last node of the list, in O(1).                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the last node.                 *
+ ******************************************************************************/
+void doublyListRemoveLast(doublyList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    doublyListRemoveNode(list, list->tail->previous);
+}
+
+/******************************************************************************
+ * doublyListRemoveFirst                                                      *
+ ******************************************************************************
+ * description: removes the first node of the list, in O(1).                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the first node.                *
+ ******************************************************************************/
+void doublyListRemoveFirst(doublyList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    doublyListRemoveNode(list, list->head->next);
+}
+
+/******************************************************************************
+ * doublyListRemoveByIndex                                                    *
+ ******************************************************************************
+ * description: removes a node at a specific position. Indexes beyond the     *
+ *              last position are ignored.                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the node at the desired        *
+ *                              position.                                     *
+ ******************************************************************************/
+void doublyListRemoveByIndex(doublyList_t *list, natural index)
+{
+    if (index >= list->size) return ;
+
+    doublyListRemoveNode(list, doublyListNodeAt(list, index));
+}
+
+/******************************************************************************
+ * doublyListSet                                                              *
+ ******************************************************************************
+ * description: sets a new value at the desired position of the list.        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void doublyListSet(doublyList_t *list, real data, natural index)
+{
+    if (index >= list->size) return ;
+
+    doublyListNodeAt(list, index)->data = data;
+}
+
+/******************************************************************************
+ * doublyListGet                                                              *
+ ******************************************************************************
+ * description: gets the value at the desired position of the list.          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : value at the desired position (-1 and an      *
+ *                              error message if there is no such value).     *
+ ******************************************************************************/
+real doublyListGet(const doublyList_t *list, natural index)
+{
+    if (index >= list->size)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    return doublyListNodeAt(list, index)->data;
+}
+
+/******************************************************************************
+ * doublyListTransverse                                                       *
+ ******************************************************************************
+ * description: prints the list on the terminal screen.                       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : printed list on the terminal screen.          *
+ ******************************************************************************/
+void doublyListTransverse(const doublyList_t *list)
+{
+    doublyListNode_t *current = list->head->next;
+
+    printf("doublyList::[");
+    while(current != list->tail)
+    {
+        printf(" %1.1f", current->data);
+        current = current->next;
+    }
+    printf(" ]\n");
+}
+
+/******************************************************************************
+ * doublyListNodeAt                                                           *
+ ******************************************************************************
+ * description: finds the node at the desired position, walking from the     *
+ *              nearest end of the list.                                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t   *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      doublyListNode_t*     : node at the desired position (NULL if there   *
+ *                              is no such node).                             *
+ ******************************************************************************/
+doublyListNode_t *doublyListNodeAt(const doublyList_t *list, natural index)
+{
+    doublyListNode_t *current;
+    register natural i;
+
+    if (index >= list->size) return NULL;
+
+    if (index < list->size / 2)
+    {
+        current = list->head->next;
+        for(i = 0; i < index; i++) current = current->next;
+    }
+    else
+    {
+        current = list->tail->previous;
+        for(i = list->size - 1; i > index; i--) current = current->previous;
+    }
+
+    return current;
+}
+
+/******************************************************************************
+ * doublyListInsertBefore                                                     *
+ ******************************************************************************
+ * description: adds a new node right before a known one, in O(1). The tail  *
+ *              sentinel may be given, to add the node at the end.            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t     *list : receives the list address (e.g, &list).      *
+ *      doublyListNode_t *node : a node of the list, or its tail sentinel.    *
+ *      real              data : a double data value.                         *
+ *                                                                            *
+ * output:                                                                    *
+ *      doublyListNode_t*      : the new node.                                *
+ ******************************************************************************/
+doublyListNode_t *doublyListInsertBefore(doublyList_t *list,
+                                         doublyListNode_t *node, real data)
+{
+    doublyListNode_t *newNode =
+        (doublyListNode_t*) linkedListPoolAlloc(&list->pool);
+
+    newNode->data     = data;
+    newNode->next     = node;
+    newNode->previous = node->previous;
+    node->previous->next = newNode;
+    node->previous       = newNode;
+    list->size++;
+
+    return newNode;
+}
+
+/******************************************************************************
+ * doublyListRemoveNode                                                       *
+ ******************************************************************************
+ * description: removes a known node from the list, in O(1).                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      doublyList_t     *list : receives the list address (e.g, &list).      *
+ *      doublyListNode_t *node : a node of the list (not a sentinel).         *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                   : a list without the node.                     *
+ ******************************************************************************/
+void doublyListRemoveNode(doublyList_t *list, doublyListNode_t *node)
+{
+    if (node == list->head || node == list->tail)
+    {
+        printf("ERROR::sentinels can not be removed\n");
+        return ;
+    }
+
+    node->previous->next = node->next;
+    node->next->previous = node->previous;
+    linkedListPoolRelease(&list->pool, node);
+    list->size--;
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+ *                          DOUBLY LINKED LISTS                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * This is a doubly linked list: each node points to the next node and to the *
+ * previous one. The list is closed by a head and a tail sentinel, so every   *
+ * node has two neighbours and there is no special case at the ends.          *
+ *                                                                            *
+ * Adding and removing at both ends are O(1), as well as removing a node      *
+ * already known (e.g., from doublyListNodeAt, or by walking from a sentinel  *
+ * up to the other one). The index-based functions walk from the nearest end. *
+ *                                                                            *
+ * The functions are the same ones of linkedList.h, and the nodes, sentinels  *
+ * included, come from a pool owned by the list (linkedListPool.h).           *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __DOUBLY_LIST_H__
+#define __DOUBLY_LIST_H__
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct doublyListNode
+{
+    real                   data;
+    struct doublyListNode *next;
+    struct doublyListNode *previous;
+
+} doublyListNode_t;
+
+typedef struct doublyList
+{
+    doublyListNode_t *head;     /*sentinel before the first node*/
+    doublyListNode_t *tail;     /*sentinel after the last node*/
+    natural           size;
+    linkedListPool_t  pool;
+
+} doublyList_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void doublyListInit(doublyList_t *list);
+void doublyListFree(doublyList_t *list);
+natural doublyListSize(const doublyList_t *list);
+void doublyListAddBegin(doublyList_t *list, real data);
+void doublyListAddEnd(doublyList_t *list, real data);
+void doublyListAddByIndex(doublyList_t *list, real data, natural index);
+void doublyListRemoveLast(doublyList_t *list);
+void doublyListRemoveFirst(doublyList_t *list);
+void doublyListRemoveByIndex(doublyList_t *list, natural index);
+void doublyListSet(doublyList_t *list, real data, natural index);
+real doublyListGet(const doublyList_t *list, natural index);
+void doublyListTransverse(const doublyList_t *list);
+doublyListNode_t *doublyListNodeAt(const doublyList_t *list, natural index);
+doublyListNode_t *doublyListInsertBefore(doublyList_t *list,
+                                         doublyListNode_t *node, real data);
+void doublyListRemoveNode(doublyList_t *list, doublyListNode_t *node);
+
+#endif
+/*****END*****/
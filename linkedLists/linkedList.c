@@ -5,16 +5,193 @@
  * E-mail: almeriopamplona@gmail.com                                          *
  ******************************************************************************
  * Creation:     20.03.2021                                                   *
- * Modification: 21.03.2021                                                   *
+ * Modification: 17.10.2026                                                   *
  ******************************************************************************/
 
 #include "linkedList.h"
+#include "linkedListInstrument.h"
+#include "linkedListWriter.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
+/******************************************************************************
+ * NODE ALLOCATION                                                            *
+ ******************************************************************************
+ * Every node goes through an allocator. The default one is the plain         *
+ * malloc/free pair, so nothing changes unless another allocator is set.      *
+ ******************************************************************************/
+static linkedList_t *linkedListMallocAlloc(void *context)
+{
+    (void) context;
+    return (linkedList_t*) malloc(sizeof(linkedList_t));
+}
+
+static void linkedListMallocRelease(void *context, linkedList_t *node)
+{
+    (void) context;
+    free(node);
+}
+
+static const linkedListAllocator_t linkedListMallocAllocator = 
+{
+    NULL, linkedListMallocAlloc, NULL, linkedListMallocRelease, NULL
+};
+
+static const linkedListAllocator_t *linkedListDefaultAllocator = 
+    &linkedListMallocAllocator;
+
+static const linkedListAllocator_t *linkedListHandleAllocator(
+    const linkedListHandle_t *handle)
+{
+    return (handle->allocator != NULL) ? handle->allocator 
+                                       : linkedListDefaultAllocator;
+}
+
+static linkedList_t *linkedListNodeAlloc(const linkedListAllocator_t *allocator,
+                                         real data)
+{
+    linkedList_t *node = allocator->alloc(allocator->context);
+    LINKED_LIST_PROBE_ALLOCATED(1);
+    node->data = data;
+    node->next = NULL;
+
+    return node;
+}
+
+static void linkedListNodeRelease(const linkedListAllocator_t *allocator, 
+                                  linkedList_t *node)
+{
+    allocator->release(allocator->context, node);
+    LINKED_LIST_PROBE_RELEASED(1);
+}
+
+/*Builds a chain of nodes holding the values of the array, linked in a single 
+  pass. The nodes come from a single block when the allocator allows it.*/
+static linkedList_t *linkedListChainFromArray(
+    const linkedListAllocator_t *allocator, const real *array, natural size,
+    linkedList_t **tail)
+{
+    linkedList_t *nodes = NULL;
+    linkedList_t *head  = NULL;
+    linkedList_t *last  = NULL;
+    register natural i;
+
+    if (size == 0) 
+    {
+        *tail = NULL;
+        return NULL;
+    }
+
+    if (allocator->allocBlock != NULL)
+    {
+        nodes = allocator->allocBlock(allocator->context, size);
+    }
+
+    if (nodes != NULL)
+    {
+        LINKED_LIST_PROBE_ALLOCATED(size);
+        for(i = 0; i < size - 1; i++)
+        {
+            nodes[i].data = array[i];
+            nodes[i].next = &nodes[i+1];
+        }
+        nodes[size-1].data = array[size-1];
+        nodes[size-1].next = NULL;
+
+        *tail = &nodes[size-1];
+        return nodes;
+    }
+
+    /*one node at a time, but still without walking the list*/
+    head = last = linkedListNodeAlloc(allocator, array[0]);
+    for(i = 1; i < size; i++)
+    {
+        last->next = linkedListNodeAlloc(allocator, array[i]);
+        last = last->next;
+    }
+
+    *tail = last;
+    return head;
+}
+
+/*Moves a position (node, previous node and index) forward until the desired
+  index. The walk restarts from the head only when the index is behind the 
+  position, or when there is no position. Past the last node, the node is 
+  NULL and the index is the size of the list.*/
+static linkedList_t *linkedListSeek(linkedList_t *head, linkedList_t **node,
+                                    linkedList_t **previous, natural *position,
+                                    natural index)
+{
+    linkedList_t *current = *node;
+    linkedList_t *before  = *previous;
+    natural       at      = *position;
+
+    if (current == NULL || index < at)
+    {
+        current = head;
+        before  = NULL;
+        at      = 0;
+    }
+
+    while(current != NULL && at < index)
+    {
+        before  = current;
+        current = current->next;
+        at++;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
+
+    *node     = current;
+    *previous = before;
+    *position = at;
+
+    return current;
+}
+
+/*Node at index of a handle, starting from the last position reached*/
+static linkedList_t *linkedListHandleSeek(linkedListHandle_t *handle, 
+                                          natural index)
+{
+    return linkedListSeek(handle->head, &handle->lastNode, 
+                          &handle->lastPrevious, &handle->lastIndex, index);
+}
+
+/******************************************************************************
+ * linkedListSetDefaultAllocator                                              *
+ ******************************************************************************
+ * description: replaces the allocator used by the bare node functions and by *
+ *              the handles that are not bound to an allocator. It must be    *
+ *              set before any node is created, since a node has to be given  *
+ *              back to the allocator it came from.                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListAllocator_t *allocator : the new default allocator (NULL    *
+ *                                         restores malloc/free).             *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                             : the default allocator is replaced. *
+ ******************************************************************************/
+void linkedListSetDefaultAllocator(const linkedListAllocator_t *allocator)
+{
+    linkedListDefaultAllocator = (allocator != NULL) ? allocator 
+                                                     : &linkedListMallocAllocator;
+}
+
+/******************************************************************************
+ * linkedListGetDefaultAllocator                                              *
+ ******************************************************************************
+ * description: returns the allocator currently used by default.              *
+ ******************************************************************************
+ * output:                                                                    *
+ *      linkedListAllocator_t *          : the default allocator.             *
+ ******************************************************************************/
+const linkedListAllocator_t *linkedListGetDefaultAllocator(void)
+{
+    return linkedListDefaultAllocator;
+}
 
 /******************************************************************************
  * linkedListNew                                                              *
@@ -31,32 +208,42 @@
  ******************************************************************************/
 linkedList_t *linkedListNew(real data)
 {
-    /*Creating the head of the list*/
-    linkedList_t *head = (linkedList_t*) malloc(sizeof(linkedList_t));
-    /*Attributing values to the node*/              
-    head->data = data;
-    /*The next node should be NULL, showing that it is the current ending*/
-    head->next = NULL;    
+    LINKED_LIST_PROBE(NEW);
+
+    /*Creating the head of the list, with the data and a NULL next node, 
+      showing that it is the current ending*/
+    linkedList_t *head = linkedListNodeAlloc(linkedListDefaultAllocator, data);
 
     return head;
 }
 
 /******************************************************************************
- * linkedListNew                                                              *
+ * linkedListFree                                                             *
  ******************************************************************************
- * description: free memory in the linked list and reduces it to a simple     *
- *              empty head.                                                   *
+ * description: frees every node of the linked list. The head is freed too,   *
+ *              so the list must not be used afterwards.                      *
  ******************************************************************************
  * parameters:                                                                *
  *      linkedList_t   list  : required full linked list.                     *
  *                                                                            *
  * output:                                                                    *
- *      void                 : required empty linked list.                    *
+ *      void                 : the memory of the list is released.            *
  ******************************************************************************/
 void linkedListFree(linkedList_t *list)
 {
-    free(list);
-    list->next = NULL;
+    LINKED_LIST_PROBE(FREE);
+
+    linkedList_t *current  = list;
+    linkedList_t *nextList = NULL;
+
+    /*the next node is read before its predecessor is released*/
+    while(current != NULL)
+    {
+        nextList = current->next;
+        linkedListNodeRelease(linkedListDefaultAllocator, current);
+        current = nextList;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
 }
 
 /******************************************************************************
@@ -75,6 +262,8 @@ void linkedListFree(linkedList_t *list)
  ******************************************************************************/
 void linkedListAddBegin(linkedList_t **list, real data)
 {
+    LINKED_LIST_PROBE(ADD_BEGIN);
+
     /*Creating the node element*/
     linkedList_t *node = linkedListNew(data);
 
@@ -102,11 +291,19 @@ void linkedListAddBegin(linkedList_t **list, real data)
  ******************************************************************************/
 void linkedListAddEnd(linkedList_t *list, real data)
 {
+    LINKED_LIST_PROBE(ADD_END);
+
     /*Moving the memory address until the last available node*/
     linkedList_t *current = list;
+    if (current == NULL)
+    {
+        printf("ERROR::list is empty, use linkedListAddBegin\n");
+        return ;
+    }
     while(current->next != NULL) 
     {
         current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
     }
     /*Appending a new node to the last node of the list*/
     current->next = linkedListNew(data);
@@ -129,42 +326,48 @@ void linkedListAddEnd(linkedList_t *list, real data)
  ******************************************************************************/
 void linkedListAddByIndex(linkedList_t **list, real data, natural index)
 {
+    LINKED_LIST_PROBE(ADD_BY_INDEX);
+
     /*If the addition is at the beginning, we call an already made function 
-      for this purpose.                                                       */
-    if (index == 0)
+      for this purpose (an empty list only has a beginning).                  */
+    if (index == 0 || *list == NULL)
     {
         linkedListAddBegin(list, data);
     }
     /*Else, we begin a search for the desired position.*/
     else
     {
-        /*moving through the list until the desired position*/
-        linkedList_t **current  = list;
+        /*moving through the list until the desired position, without 
+          moving the head of the caller*/
+        linkedList_t *current  = *list;
         register natural i;
         for(i = 0; i < index-1; i++) 
         {    
             /*if the last position, we call a specific function for this*/  
-            if ((*current)->next == NULL) 
+            if (current->next == NULL) 
             {
-                linkedListAddEnd((*list), data);
+                linkedListAddEnd(current, data);
                 return ;
             }
-            (*current) = (*current)->next;
+            current = current->next;
+            LINKED_LIST_PROBE_TRAVERSED(1);
         }
 
         /*creating a new node with the input data*/
         linkedList_t *tempList = linkedListNew(data);
         /*append the rest of the list in the node pointer*/
-        tempList->next = (*current)->next;
+        tempList->next = current->next;
         /*saving all the changes as the current list*/
-        (*current)->next = tempList; 
+        current->next = tempList; 
     }
 }
 
 /******************************************************************************
  * linkedListRemoveLast                                                       *
  ******************************************************************************
- * description: removes the last node of the linked list.                     *
+ * description: removes the last node of the linked list. A list of a single *
+ *              node keeps it (its head can only be removed by               *
+ *              linkedListRemoveFirst).                                       *
  ******************************************************************************
  * parameters:                                                                *
  *      linkedList_t  *list  : receives the list (e.g, list).                 *
@@ -174,10 +377,17 @@ void linkedListAddByIndex(linkedList_t **list, real data, natural index)
  ******************************************************************************/
 void linkedListRemoveLast(linkedList_t *list)
 {
-    /*if the linked list has only one node*/
-    if (list->next == NULL) 
+    LINKED_LIST_PROBE(REMOVE_LAST);
+
+    if (list == NULL)
+    {
+        printf("ERROR::list is empty\n");
+    }
+    /*if the linked list has only one node, the caller's head cannot be 
+      cleared from here*/
+    else if (list->next == NULL) 
     {
-        linkedListFree(list);
+        printf("ERROR::the last node is the head, use linkedListRemoveFirst\n");
     }
     /*if the linked list has more than one*/
     else
@@ -187,9 +397,10 @@ void linkedListRemoveLast(linkedList_t *list)
         while(current->next->next != NULL) 
         {
             current = current->next;
+            LINKED_LIST_PROBE_TRAVERSED(1);
         }
         /*free the memory of the last node*/
-        free(current->next);
+        linkedListNodeRelease(linkedListDefaultAllocator, current->next);
         current->next = NULL;
     }
 }
@@ -207,19 +418,21 @@ void linkedListRemoveLast(linkedList_t *list)
  ******************************************************************************/
 void linkedListRemoveFirst(linkedList_t **list)
 {
+    LINKED_LIST_PROBE(REMOVE_FIRST);
+
     /*Creating a support list to hold part of the linked list*/
     linkedList_t *nextList = NULL;
     /*If the list is empty, return an error*/
     if (*list == NULL) 
     {   
-        printf("ERROR::list is empty"); 
+        printf("ERROR::list is empty\n"); 
         return ;
     }
     /*saving all the list elements, starting from the first node after the 
       first position.                                                        */
     nextList = (*list)->next;
     /* now, free the input list memory*/
-    free(*list);
+    linkedListNodeRelease(linkedListDefaultAllocator, *list);
     /*returns the rest of the list elements*/
     *list = nextList; 
 }
@@ -239,6 +452,8 @@ void linkedListRemoveFirst(linkedList_t **list)
  ******************************************************************************/
 void linkedListRemoveByIndex(linkedList_t **list, natural index)
 {
+    LINKED_LIST_PROBE(REMOVE_BY_INDEX);
+
     if (index == 0)
     {
         linkedListRemoveFirst(list);
@@ -249,24 +464,29 @@ void linkedListRemoveByIndex(linkedList_t **list, natural index)
         linkedList_t *current  = *list;
         linkedList_t *tempList = NULL;
         register natural i;
+
+        /*stopping at the node before the index, if both exist*/
         for(i = 0; i < index-1; i++)
         {
-            if(current->next == NULL) return;
+            if (current == NULL) return;
 
             current = current->next;
+            LINKED_LIST_PROBE_TRAVERSED(1);
         }
+        if (current == NULL || current->next == NULL) return;
 
         tempList = current->next;
         current->next = tempList->next;
 
-        free(tempList);
+        linkedListNodeRelease(linkedListDefaultAllocator, tempList);
     }
 }
 
 /******************************************************************************
  * linkedListGet                                                              *
  ******************************************************************************
- * description: removes the first node of the linked list.                    *
+ * description: returns the value at a position of the linked list (-1, with  *
+ *              an error message, past its end).                              *
  ******************************************************************************
  * parameters:                                                                *
  *      linkedList_t   *list  : receives the list (e.g, list).                *
@@ -277,35 +497,37 @@ void linkedListRemoveByIndex(linkedList_t **list, natural index)
  ******************************************************************************/
 real linkedListGet(linkedList_t *list, natural index)
 {
-    /*Return the first element, if required:*/
-    if (index == 0) return list->data;
+    LINKED_LIST_PROBE(GET);
 
     linkedList_t *current  = list;
 
     /*Searching for the n-th required element*/
     register natural i;
     
-    for (i = 0; i < index-1; i++)
+    for (i = 0; i < index && current != NULL; i++)
     {
-        if (current->next == NULL) 
-        {
-            printf("ERROR::There is no data or node for index %d\n", index);
-            return -1;
-        }
-
         current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
     } 
 
-    return current->next->data;
+    if (current == NULL) 
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    return current->data;
 }
 
 /******************************************************************************
  * linkedListSet                                                              *
  ******************************************************************************
- * description: removes the first node of the linked list.                    *
+ * description: sets the value at a position of the linked list. Past its end *
+ *              the list is left as it is.                                    *
  ******************************************************************************
  * parameters:                                                                *
- *      linkedList_t  **list  : receives the list head address (e.g, &list).  *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *      real            data  : a double data value.                          *
  *      natural         index : desired position in the list                  *
  *                                                                            *
  * output:                                                                    *
@@ -314,25 +536,19 @@ real linkedListGet(linkedList_t *list, natural index)
  ******************************************************************************/
 void linkedListSet(linkedList_t *list, real data, natural index)
 {
-    /*for the first element*/
-    if (index == 0)
-    {
-        list->data = data;
-    }
-    /*for others elements*/
-    else
-    {
-        linkedList_t *current  = list;
-        register natural i;
-        for(i = 0; i < index-1; i++) 
-        {    
-            if (current->next == NULL) return;
+    LINKED_LIST_PROBE(SET);
 
-            current = current->next;
-        }
+    linkedList_t *current  = list;
+    register natural i;
 
-        current->next->data = data;
+    /*past the end, the list is left as it is*/
+    for(i = 0; i < index && current != NULL; i++) 
+    {    
+        current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
     }
+
+    if (current != NULL) current->data = data;
 }
 
 /******************************************************************************
@@ -348,15 +564,953 @@ void linkedListSet(linkedList_t *list, real data, natural index)
  ******************************************************************************/
 void linkedListTransverse(linkedList_t *list)
 {   
+    LINKED_LIST_PROBE(TRANSVERSE);
+
     /*Copying our list into a new one, in order to not modify it*/
     linkedList_t *current = list;
+    linkedListWriter_t writer;
+
+    /*Buffered through stdout, printed as printf(" %1.1f") would do*/
+    linkedListWriterInitFile(&writer, stdout);
 
     /*Moving through the list while printing the current data*/
-    printf("linkedList::[");
+    linkedListWriterText(&writer, "linkedList::[");
+    while(current != NULL)
+    {
+        linkedListWriterText(&writer, " ");
+        linkedListWriterReal(&writer, current->data);
+        current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
+    linkedListWriterText(&writer, " ]\n");
+    linkedListWriterFlush(&writer);
+}
+
+/******************************************************************************
+ * linkedListFromArray                                                        *
+ ******************************************************************************
+ * description: creates a linked list holding the values of an array, in the  *
+ *              same order. The nodes are linked in a single pass, and come   *
+ *              from a single block if the default allocator allows it.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      real          *array : contiguous values.                             *
+ *      natural        size  : number of values in the array.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      linkedList_t         : head of the new list (NULL if size is 0).      *
+ ******************************************************************************/
+linkedList_t *linkedListFromArray(const real *array, natural size)
+{
+    LINKED_LIST_PROBE(FROM_ARRAY);
+
+    linkedList_t *tail;
+
+    return linkedListChainFromArray(linkedListDefaultAllocator, array, size, 
+                                    &tail);
+}
+
+/******************************************************************************
+ * linkedListToArray                                                          *
+ ******************************************************************************
+ * description: copies the values of the list into a new array, which must be *
+ *              freed by the caller. The list is walked twice: once to count  *
+ *              the nodes and once to copy them.                              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t  *list  : receives the list (e.g, list).                 *
+ *      natural       *size  : receives the number of values copied.          *
+ *                                                                            *
+ * output:                                                                    *
+ *      real*                : the new array (NULL for an empty list).        *
+ ******************************************************************************/
+real *linkedListToArray(const linkedList_t *list, natural *size)
+{
+    LINKED_LIST_PROBE(TO_ARRAY);
+
+    const linkedList_t *current = list;
+    real *array = NULL;
+    natural count = 0;
+
     while(current != NULL)
     {
-        printf(" %1.1f", current->data);
+        count++;
+        current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
+
+    *size = 0;
+    if (count == 0) return NULL;
+
+    array = (real*) malloc(count * sizeof(real));
+    if (array == NULL)
+    {
+        printf("ERROR::out of memory\n");
+        return NULL;
+    }
+
+    *size = linkedListCopyInto(list, array, count);
+
+    return array;
+}
+
+/******************************************************************************
+ * linkedListCopyInto                                                         *
+ ******************************************************************************
+ * description: copies the values of the list into the caller buffer, in a    *
+ *              single traversal, until the list or the buffer ends.          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t  *list     : receives the list (e.g, list).              *
+ *      real          *buffer   : receives the values.                        *
+ *      natural        capacity : number of values the buffer can hold.       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural                 : number of values copied.                    *
+ ******************************************************************************/
+natural linkedListCopyInto(const linkedList_t *list, real *buffer, 
+                           natural capacity)
+{
+    LINKED_LIST_PROBE(COPY_INTO);
+
+    const linkedList_t *current = list;
+    natural count = 0;
+
+    while(current != NULL && count < capacity)
+    {
+        buffer[count++] = current->data;
         current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
+
+    return count;
+}
+
+/******************************************************************************
+ * linkedListHandleInit                                                       *
+ ******************************************************************************
+ * description: initializes an empty list handle. The handle owns the nodes   *
+ *              that are added through the handle functions.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : an empty handle (no head, no tail).      *
+ ******************************************************************************/
+void linkedListHandleInit(linkedListHandle_t *handle)
+{
+    linkedListHandleInitWith(handle, NULL);
+}
+
+/******************************************************************************
+ * linkedListHandleInitWith                                                   *
+ ******************************************************************************
+ * description: initializes an empty list handle whose nodes come from the    *
+ *              given allocator (e.g., a linkedListPool_t).                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t    *handle    : receives the handle address.       *
+ *      linkedListAllocator_t *allocator : node allocator (NULL means the     *
+ *                                         default allocator).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                             : an empty handle.                   *
+ ******************************************************************************/
+void linkedListHandleInitWith(linkedListHandle_t *handle, 
+                              const linkedListAllocator_t *allocator)
+{
+    handle->head      = NULL;
+    handle->tail      = NULL;
+    handle->size      = 0;
+    handle->allocator = allocator;
+
+    handle->lastNode     = NULL;
+    handle->lastPrevious = NULL;
+    handle->lastIndex    = 0;
+}
+
+/******************************************************************************
+ * linkedListHandleFree                                                       *
+ ******************************************************************************
+ * description: frees every node owned by the handle and leaves it empty. If  *
+ *              the allocator can take a whole chain back, the list is given  *
+ *              back at once, without walking it.                             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : an empty handle.                         *
+ ******************************************************************************/
+void linkedListHandleFree(linkedListHandle_t *handle)
+{
+    LINKED_LIST_PROBE(HANDLE_FREE);
+
+    const linkedListAllocator_t *allocator = linkedListHandleAllocator(handle);
+    linkedList_t *current  = handle->head;
+    linkedList_t *nextList = NULL;
+
+    if (current != NULL && allocator->releaseList != NULL)
+    {
+        allocator->releaseList(allocator->context, handle->head, handle->tail);
+        LINKED_LIST_PROBE_RELEASED(handle->size);
+    }
+    else
+    {
+        while(current != NULL)
+        {
+            nextList = current->next;
+            linkedListNodeRelease(allocator, current);
+            current = nextList;
+            LINKED_LIST_PROBE_TRAVERSED(1);
+        }
+    }
+
+    linkedListHandleInitWith(handle, handle->allocator);
+}
+
+/******************************************************************************
+ * linkedListHandleSize                                                       *
+ ******************************************************************************
+ * description: returns the number of nodes of the list in O(1).              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural                    : number of nodes in the list.             *
+ ******************************************************************************/
+natural linkedListHandleSize(const linkedListHandle_t *handle)
+{
+    return handle->size;
+}
+
+/******************************************************************************
+ * linkedListHandlePrepend                                                    *
+ ******************************************************************************
+ * description: adds a new node at the beginning of the list in O(1).         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      real                data   : a double data value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new node at the beginning of the list. *
+ ******************************************************************************/
+void linkedListHandlePrepend(linkedListHandle_t *handle, real data)
+{
+    LINKED_LIST_PROBE(HANDLE_PREPEND);
+
+    linkedList_t *node = linkedListNodeAlloc(linkedListHandleAllocator(handle),
+                                             data);
+    node->next = handle->head;
+    handle->head = node;
+
+    /*The first node of an empty list is also its last node*/
+    if (handle->tail == NULL) handle->tail = handle->head;
+
+    /*every index moved, so the last position is forgotten*/
+    handle->lastNode = NULL;
+    handle->size++;
+}
+
+/******************************************************************************
+ * linkedListHandleAppend                                                     *
+ ******************************************************************************
+ * description: adds a new node at the end of the list in O(1). Unlike        *
+ *              linkedListAddEnd, there is no walk up to the last node, since *
+ *              the handle already knows where the tail is.                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      real                data   : a double data value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new node at the end of the list.       *
+ ******************************************************************************/
+void linkedListHandleAppend(linkedListHandle_t *handle, real data)
+{
+    LINKED_LIST_PROBE(HANDLE_APPEND);
+
+    linkedList_t *node = linkedListNodeAlloc(linkedListHandleAllocator(handle),
+                                             data);
+
+    if (handle->tail == NULL)
+    {
+        handle->head = node;
     }
-    printf(" ]\n");
+    else
+    {
+        handle->tail->next = node;
+    }
+
+    handle->tail = node;
+    handle->size++;
+}
+
+/******************************************************************************
+ * linkedListHandleAppendArray                                                *
+ ******************************************************************************
+ * description: appends the values of an array at the end of the list. The    *
+ *              new nodes are linked in a single pass, and come from a single *
+ *              block if the allocator of the handle allows it (e.g., a pool).*
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      real               *array  : contiguous values.                       *
+ *      natural             size   : number of values in the array.           *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the values at the end of the list.       *
+ ******************************************************************************/
+void linkedListHandleAppendArray(linkedListHandle_t *handle, const real *array,
+                                 natural size)
+{
+    LINKED_LIST_PROBE(HANDLE_APPEND_ARRAY);
+
+    linkedList_t *tail;
+    linkedList_t *head = linkedListChainFromArray(
+        linkedListHandleAllocator(handle), array, size, &tail);
+
+    if (head == NULL) return ;
+
+    if (handle->tail == NULL) handle->head = head;
+    else                      handle->tail->next = head;
+
+    handle->tail  = tail;
+    handle->size += size;
+}
+
+/******************************************************************************
+ * linkedListHandleAddByIndex                                                 *
+ ******************************************************************************
+ * description: adds a new node at some specific position of the list. An    *
+ *              index beyond the last position appends the node, as it is     *
+ *              done by linkedListAddByIndex.                                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      real                data   : a double data value.                     *
+ *      natural             index  : unsigned int index value.                *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new node at the desired position.      *
+ ******************************************************************************/
+void linkedListHandleAddByIndex(linkedListHandle_t *handle, real data, 
+                                natural index)
+{
+    LINKED_LIST_PROBE(HANDLE_ADD_BY_INDEX);
+
+    /*The ends are O(1), thanks to the head and tail pointers*/
+    if (index == 0)
+    {
+        linkedListHandlePrepend(handle, data);
+        return ;
+    }
+    if (index >= handle->size)
+    {
+        linkedListHandleAppend(handle, data);
+        return ;
+    }
+
+    /*moving through the list until the node before the desired position,
+      which stays as the last position reached*/
+    linkedList_t *current = linkedListHandleSeek(handle, index-1);
+
+    linkedList_t *node = linkedListNodeAlloc(linkedListHandleAllocator(handle),
+                                             data);
+    node->next = current->next;
+    current->next = node;
+    handle->size++;
+}
+
+/******************************************************************************
+ * linkedListHandlePopFront                                                   *
+ ******************************************************************************
+ * description: removes the first node of the list in O(1) and returns its    *
+ *              data.                                                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                       : data of the removed node (-1 and an      *
+ *                                   error message if the list is empty).     *
+ ******************************************************************************/
+real linkedListHandlePopFront(linkedListHandle_t *handle)
+{
+    LINKED_LIST_PROBE(HANDLE_POP_FRONT);
+
+    if (handle->head == NULL)
+    {
+        printf("ERROR::list is empty\n");
+        return -1;
+    }
+
+    linkedList_t *first = handle->head;
+    real data = first->data;
+    handle->head = first->next;
+    linkedListNodeRelease(linkedListHandleAllocator(handle), first);
+
+    if (handle->head == NULL) handle->tail = NULL;
+    handle->lastNode = NULL;
+    handle->size--;
+
+    return data;
+}
+
+/******************************************************************************
+ * linkedListHandleRemoveLast                                                 *
+ ******************************************************************************
+ * description: removes the last node of the list. In a single linked list,   *
+ *              the new tail still has to be found by walking from the head.  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a list without the last node.            *
+ ******************************************************************************/
+void linkedListHandleRemoveLast(linkedListHandle_t *handle)
+{
+    LINKED_LIST_PROBE(HANDLE_REMOVE_LAST);
+
+    if (handle->head == NULL)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+    if (handle->head == handle->tail)
+    {
+        linkedListHandlePopFront(handle);
+        return ;
+    }
+
+    /*looking for the node one position before the last node*/
+    linkedList_t *current = handle->head;
+    while(current->next != handle->tail)
+    {
+        current = current->next;
+        LINKED_LIST_PROBE_TRAVERSED(1);
+    }
+
+    if (handle->lastNode == handle->tail) handle->lastNode = NULL;
+
+    linkedListNodeRelease(linkedListHandleAllocator(handle), handle->tail);
+    current->next = NULL;
+    handle->tail = current;
+    handle->size--;
+}
+
+/******************************************************************************
+ * linkedListHandleRemoveByIndex                                              *
+ ******************************************************************************
+ * description: removes a node at a specific position. Indexes beyond the     *
+ *              last position are ignored.                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      natural             index  : desired position in the list.            *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a list without the node at the desired   *
+ *                                   position.                                *
+ ******************************************************************************/
+void linkedListHandleRemoveByIndex(linkedListHandle_t *handle, natural index)
+{
+    LINKED_LIST_PROBE(HANDLE_REMOVE_BY_INDEX);
+
+    if (index >= handle->size) return ;
+
+    if (index == 0)
+    {
+        linkedListHandlePopFront(handle);
+        return ;
+    }
+
+    linkedList_t *current = linkedListHandleSeek(handle, index-1);
+    linkedList_t *tempList = current->next;
+    current->next = tempList->next;
+
+    /*removing the last node moves the tail one position back*/
+    if (tempList == handle->tail) handle->tail = current;
+
+    linkedListNodeRelease(linkedListHandleAllocator(handle), tempList);
+    handle->size--;
+}
+
+/******************************************************************************
+ * linkedListHandleSet                                                        *
+ ******************************************************************************
+ * description: sets a new value at the desired position of the list. The     *
+ *              walk starts from the last position reached, if it is not      *
+ *              beyond the desired one, so a loop over increasing indexes is  *
+ *              O(1) per step.                                                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      real                data   : a double data value.                     *
+ *      natural             index  : desired position in the list.            *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new value at the desired position.     *
+ ******************************************************************************/
+void linkedListHandleSet(linkedListHandle_t *handle, real data, natural index)
+{
+    LINKED_LIST_PROBE(HANDLE_SET);
+
+    if (index >= handle->size) return ;
+
+    /*The last node does not need a walk*/
+    if (index == handle->size - 1)
+    {
+        handle->tail->data = data;
+        return ;
+    }
+
+    linkedListHandleSeek(handle, index)->data = data;
+}
+
+/******************************************************************************
+ * linkedListHandleGet                                                        *
+ ******************************************************************************
+ * description: gets the data at the desired position of the list. The walk   *
+ *              starts from the last position reached, if it is not beyond    *
+ *              the desired one, so a loop over increasing indexes is O(1)    *
+ *              per step.                                                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      natural             index  : desired position in the list.            *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                       : data at the desired position (-1 and an  *
+ *                                   error message if there is no such node). *
+ ******************************************************************************/
+real linkedListHandleGet(linkedListHandle_t *handle, natural index)
+{
+    LINKED_LIST_PROBE(HANDLE_GET);
+
+    if (index >= handle->size)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    /*The last node does not need a walk*/
+    if (index == handle->size - 1) return handle->tail->data;
+
+    return linkedListHandleSeek(handle, index)->data;
+}
+
+/******************************************************************************
+ * linkedListHandleTransverse                                                 *
+ ******************************************************************************
+ * description: prints the list owned by the handle.                          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : printed list on the terminal screen.     *
+ ******************************************************************************/
+void linkedListHandleTransverse(const linkedListHandle_t *handle)
+{
+    LINKED_LIST_PROBE(HANDLE_TRANSVERSE);
+
+    linkedListTransverse(handle->head);
+}
+
+/******************************************************************************
+ * linkedListCursorBegin                                                      *
+ ******************************************************************************
+ * description: places a cursor at the first node of the list of a handle.    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a cursor at index 0 (past the end if the *
+ *                                   list is empty).                          *
+ ******************************************************************************/
+void linkedListCursorBegin(linkedListCursor_t *cursor, 
+                           linkedListHandle_t *handle)
+{
+    cursor->handle   = handle;
+    cursor->node     = handle->head;
+    cursor->previous = NULL;
+    cursor->index    = 0;
+}
+
+/******************************************************************************
+ * linkedListCursorValid                                                      *
+ ******************************************************************************
+ * description: tells if the cursor is at a node, or past the last one.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                        : 1 at a node, 0 past the last node.       *
+ ******************************************************************************/
+int linkedListCursorValid(const linkedListCursor_t *cursor)
+{
+    return cursor->node != NULL;
+}
+
+/******************************************************************************
+ * linkedListCursorNext                                                       *
+ ******************************************************************************
+ * description: moves the cursor to the next node in O(1).                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the cursor one position ahead.           *
+ ******************************************************************************/
+void linkedListCursorNext(linkedListCursor_t *cursor)
+{
+    LINKED_LIST_PROBE(CURSOR_NEXT);
+
+    if (cursor->node == NULL) return ;
+
+    cursor->previous = cursor->node;
+    cursor->node     = cursor->node->next;
+    cursor->index++;
+    LINKED_LIST_PROBE_TRAVERSED(1);
+}
+
+/******************************************************************************
+ * linkedListCursorSeek                                                       *
+ ******************************************************************************
+ * description: moves the cursor to the desired index. The walk starts from   *
+ *              the cursor when the index is not behind it, and from the head *
+ *              otherwise.                                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *      natural             index  : desired position in the list.            *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the cursor at the desired position (past *
+ *                                   the end if there is no such node).       *
+ ******************************************************************************/
+void linkedListCursorSeek(linkedListCursor_t *cursor, natural index)
+{
+    LINKED_LIST_PROBE(CURSOR_SEEK);
+
+    linkedListSeek(cursor->handle->head, &cursor->node, &cursor->previous, 
+                   &cursor->index, index);
+}
+
+/******************************************************************************
+ * linkedListCursorGet                                                        *
+ ******************************************************************************
+ * description: gets the data of the node at the cursor.                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                       : data at the cursor (-1 and an error      *
+ *                                   message if it is past the end).          *
+ ******************************************************************************/
+real linkedListCursorGet(const linkedListCursor_t *cursor)
+{
+    LINKED_LIST_PROBE(CURSOR_GET);
+
+    if (cursor->node == NULL)
+    {
+        printf("ERROR::There is no data or node for index %d\n", 
+               cursor->index);
+        return -1;
+    }
+
+    return cursor->node->data;
+}
+
+/******************************************************************************
+ * linkedListCursorSet                                                        *
+ ******************************************************************************
+ * description: sets a new value at the node of the cursor.                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *      real                data   : a double data value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new value at the cursor.               *
+ ******************************************************************************/
+void linkedListCursorSet(linkedListCursor_t *cursor, real data)
+{
+    LINKED_LIST_PROBE(CURSOR_SET);
+
+    if (cursor->node == NULL) return ;
+
+    cursor->node->data = data;
+}
+
+/******************************************************************************
+ * linkedListCursorInsertAfter                                                *
+ ******************************************************************************
+ * description: adds a new node right after the node of the cursor, in O(1). *
+ *              The cursor stays where it is.                                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *      real                data   : a double data value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a new node after the cursor.             *
+ ******************************************************************************/
+void linkedListCursorInsertAfter(linkedListCursor_t *cursor, real data)
+{
+    LINKED_LIST_PROBE(CURSOR_INSERT_AFTER);
+
+    linkedListHandle_t *handle = cursor->handle;
+
+    if (cursor->node == NULL)
+    {
+        printf("ERROR::cursor is past the end of the list\n");
+        return ;
+    }
+
+    linkedList_t *node = linkedListNodeAlloc(linkedListHandleAllocator(handle),
+                                             data);
+    node->next = cursor->node->next;
+    cursor->node->next = node;
+
+    if (handle->tail == cursor->node) handle->tail = node;
+    handle->lastNode = NULL;
+    handle->size++;
+}
+
+/******************************************************************************
+ * linkedListCursorErase                                                      *
+ ******************************************************************************
+ * description: removes the node of the cursor, in O(1). The cursor moves to  *
+ *              the next node, which takes the same index.                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListCursor_t *cursor : receives the cursor address (&cursor).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : a list without the node of the cursor.   *
+ ******************************************************************************/
+void linkedListCursorErase(linkedListCursor_t *cursor)
+{
+    LINKED_LIST_PROBE(CURSOR_ERASE);
+
+    linkedListHandle_t *handle = cursor->handle;
+    linkedList_t *node = cursor->node;
+
+    if (node == NULL)
+    {
+        printf("ERROR::cursor is past the end of the list\n");
+        return ;
+    }
+
+    if (cursor->previous == NULL) handle->head = node->next;
+    else                          cursor->previous->next = node->next;
+
+    if (handle->tail == node) handle->tail = cursor->previous;
+
+    cursor->node = node->next;
+    linkedListNodeRelease(linkedListHandleAllocator(handle), node);
+
+    handle->lastNode = NULL;
+    handle->size--;
+}
+
+/******************************************************************************
+ * BATCH EDITS                                                                *
+ ******************************************************************************
+ * The edits are sorted by index, and the ones with the same index keep their *
+ * order in the batch (they are pointers into the same array, so the address  *
+ * breaks the ties). Then the list is walked once: the inserted nodes are     *
+ * linked behind the walk, so the index of the walk only counts the nodes of  *
+ * the list as it was before the batch.                                       *
+ ******************************************************************************/
+static int linkedListEditCompare(const void *a, const void *b)
+{
+    const linkedListEdit_t *first  = *(const linkedListEdit_t* const*) a;
+    const linkedListEdit_t *second = *(const linkedListEdit_t* const*) b;
+
+    if (first->index != second->index) 
+    {
+        return first->index < second->index ? -1 : 1;
+    }
+
+    return (first > second) - (first < second);
+}
+
+/*Applies the edits to the chain from *head, updating *tail when it is given. 
+  Returns the new number of nodes, given the old one.*/
+static natural linkedListEditChain(const linkedListAllocator_t *allocator,
+                                   linkedList_t **head, linkedList_t **tail,
+                                   natural size, const linkedListEdit_t *edits,
+                                   natural count)
+{
+    const linkedListEdit_t **order;
+    linkedList_t *inserted = NULL;
+    linkedList_t *insertedTail;
+    linkedList_t *previous = NULL;
+    linkedList_t *current  = *head;
+    linkedList_t *node;
+    real *values = NULL;
+    natural inserts = 0;
+    natural at = 0;
+    register natural i;
+
+    order = (const linkedListEdit_t**) malloc(count * sizeof(*order));
+    if (order == NULL)
+    {
+        printf("ERROR::out of memory\n");
+        return size;
+    }
+
+    for(i = 0; i < count; i++) order[i] = &edits[i];
+    qsort(order, count, sizeof(*order), linkedListEditCompare);
+
+    /*every inserted node is allocated at once, in the order they are linked*/
+    for(i = 0; i < count; i++) 
+    {
+        inserts += order[i]->op == LINKED_LIST_EDIT_INSERT;
+    }
+    if (inserts > 0)
+    {
+        values = (real*) malloc(inserts * sizeof(real));
+        if (values == NULL)
+        {
+            printf("ERROR::out of memory\n");
+            free(order);
+            return size;
+        }
+
+        for(i = 0, inserts = 0; i < count; i++)
+        {
+            if (order[i]->op == LINKED_LIST_EDIT_INSERT) 
+            {
+                values[inserts++] = order[i]->data;
+            }
+        }
+        inserted = linkedListChainFromArray(allocator, values, inserts, 
+                                            &insertedTail);
+        free(values);
+    }
+
+    for(i = 0; i < count; i++)
+    {
+        const linkedListEdit_t *edit = order[i];
+
+        while(current != NULL && at < edit->index)
+        {
+            previous = current;
+            current  = current->next;
+            at++;
+            LINKED_LIST_PROBE_TRAVERSED(1);
+        }
+
+        switch(edit->op)
+        {
+            case LINKED_LIST_EDIT_INSERT:
+                node     = inserted;
+                inserted = inserted->next;
+
+                node->next = current;
+                if (previous == NULL) *head = node;
+                else                  previous->next = node;
+                previous = node;
+                size++;
+                break;
+
+            case LINKED_LIST_EDIT_REMOVE:
+                /*past the end, or a node already removed by this batch*/
+                if (current == NULL || at != edit->index) break;
+
+                node    = current;
+                current = current->next;
+                at++;
+
+                if (previous == NULL) *head = current;
+                else                  previous->next = current;
+                linkedListNodeRelease(allocator, node);
+                size--;
+                break;
+
+            case LINKED_LIST_EDIT_SET:
+                if (current == NULL || at != edit->index) break;
+
+                current->data = edit->data;
+                break;
+        }
+    }
+
+    /*the walk reached the end, so the last node it saw is the tail*/
+    if (tail != NULL && current == NULL) *tail = previous;
+
+    free(order);
+    return size;
+}
+
+/******************************************************************************
+ * linkedListApply                                                            *
+ ******************************************************************************
+ * description: applies a batch of edits in a single walk through the list.  *
+ *              Every index refers to the list as it was before the batch:    *
+ *              insertions go before the node at their index (at the end if   *
+ *              it is beyond the last position), and removals and sets target *
+ *              the node at their index (they are ignored when it is beyond   *
+ *              the last position, or already removed). Edits with the same   *
+ *              index are applied in their order in the batch.                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t    **list  : receives the list address (e.g, &list).     *
+ *      linkedListEdit_t *edits : array of edits.                             *
+ *      natural           count : number of edits.                            *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : the edited list (NULL if every node was     *
+ *                                removed).                                   *
+ ******************************************************************************/
+void linkedListApply(linkedList_t **list, const linkedListEdit_t *edits, 
+                     natural count)
+{
+    LINKED_LIST_PROBE(APPLY);
+
+    if (count == 0) return ;
+
+    linkedListEditChain(linkedListDefaultAllocator, list, NULL, 0, edits, 
+                        count);
+}
+
+/******************************************************************************
+ * linkedListHandleApply                                                      *
+ ******************************************************************************
+ * description: applies a batch of edits to the list of a handle, in a single *
+ *              walk, as it is done by linkedListApply. The walk stops after  *
+ *              the last edited position.                                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      linkedListEdit_t   *edits  : array of edits.                          *
+ *      natural             count  : number of edits.                         *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the edited list.                         *
+ ******************************************************************************/
+void linkedListHandleApply(linkedListHandle_t *handle, 
+                           const linkedListEdit_t *edits, natural count)
+{
+    LINKED_LIST_PROBE(HANDLE_APPLY);
+
+    if (count == 0) return ;
+
+    handle->size = linkedListEditChain(linkedListHandleAllocator(handle), 
+                                       &handle->head, &handle->tail, 
+                                       handle->size, edits, count);
+    handle->lastNode = NULL;
 }
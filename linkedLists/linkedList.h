@@ -5,7 +5,7 @@
  * E-mail: almeriopamplona@gmail.com                                          *
  ******************************************************************************
  * Creation:     20.03.2021                                                   *
- * Modification: 21.03.2021                                                   *
+ * Modification: 17.10.2026                                                   *
  ******************************************************************************
  * Description:                                                               * 
  *                                                                            *
@@ -13,6 +13,31 @@
  * remove, set and get a node. Furthermore, there is a method to transverse   *
  * the linked list.                                                           *
  *                                                                            *
+ * The bare node (linkedList_t) can also be owned by a list handle, which     *
+ * keeps the head, the tail and the number of nodes, so appending, prepending,*
+ * popping the first node and asking for the size are O(1) operations.       *
+ *                                                                            *
+ * Nodes are obtained from an allocator (linkedListAllocator_t). By default,  *
+ * it is the plain malloc/free pair, but a handle can be bound to another one *
+ * (e.g., the node pool of linkedListPool.h), and the default can be replaced *
+ * for the bare node functions as well.                                       *
+ *                                                                            *
+ * A list can be built from, or exported to, a contiguous array of values in  *
+ * a single pass. When the allocator can give many contiguous nodes at once,  *
+ * all the nodes of the new list come from a single block.                    *
+ *                                                                            *
+ * A cursor remembers a node of a handle, its predecessor and its index, so a *
+ * sequential walk moves one node per step instead of restarting from the     *
+ * head. The index-based handle functions also keep the last position they   *
+ * reached, and move forward from it when the next index is not behind it.   *
+ * Changing the list through the handle invalidates the cursors on it.        *
+ *                                                                            *
+ * Many index-based edits (linkedListEdit_t) can be applied as a batch, in a  *
+ * single walk: the edits are sorted by index, and every index refers to the  *
+ * list as it was before the batch, so O(n + k log k) for k edits instead of  *
+ * O(k n). The inserted nodes come from a single block when the allocator     *
+ * allows it.                                                                 *
+ *                                                                            *
  ******************************************************************************/
 
 #ifndef __LINKED_LIST_H__
@@ -31,6 +56,68 @@ typedef struct linkedList
 
 } linkedList_t;
 
+typedef struct linkedListAllocator
+{
+    void          *context;
+    linkedList_t *(*alloc)(void *context);
+    /*optional: gives count contiguous nodes, each one releasable on its own*/
+    linkedList_t *(*allocBlock)(void *context, natural count);
+    void          (*release)(void *context, linkedList_t *node);
+    /*optional: gives a whole chain of nodes (head to tail) back at once*/
+    void          (*releaseList)(void *context, linkedList_t *head, 
+                                 linkedList_t *tail);
+
+} linkedListAllocator_t;
+
+typedef struct linkedListHandle
+{
+    linkedList_t                *head;
+    linkedList_t                *tail;
+    natural                      size;
+    const linkedListAllocator_t *allocator;
+    /*last position reached by the index-based functions (lastNode is NULL 
+      when there is none)*/
+    linkedList_t                *lastNode;
+    linkedList_t                *lastPrevious;
+    natural                      lastIndex;
+
+} linkedListHandle_t;
+
+typedef struct linkedListCursor
+{
+    linkedListHandle_t *handle;
+    linkedList_t       *node;       /*NULL when past the last node*/
+    linkedList_t       *previous;   /*NULL at the first node*/
+    natural             index;
+
+} linkedListCursor_t;
+
+typedef enum linkedListEditOp
+{
+    LINKED_LIST_EDIT_INSERT = 0,  /*before the node at index (or at the end)*/
+    LINKED_LIST_EDIT_REMOVE,      /*the node at index*/
+    LINKED_LIST_EDIT_SET          /*the node at index*/
+
+} linkedListEditOp_t;
+
+typedef struct linkedListEdit
+{
+    linkedListEditOp_t op;
+    natural            index;     /*position before the batch*/
+    real               data;      /*ignored by removals*/
+
+} linkedListEdit_t;
+
+/*Tells whether a value is selected (count-if, filter): non-zero if it is*/
+typedef int (*linkedListPredicate_t)(real data, void *context);
+
+/******************************************************************************
+ * ALLOCATOR FUNCTIONS                                                        *
+ ******************************************************************************/
+
+void linkedListSetDefaultAllocator(const linkedListAllocator_t *allocator);
+const linkedListAllocator_t *linkedListGetDefaultAllocator(void);
+
 /******************************************************************************
  * HANDLE FUNCTIONS                                                           *
  ******************************************************************************/
@@ -47,5 +134,59 @@ void linkedListSet(linkedList_t *list, real data, natural index);
 real linkedListGet(linkedList_t *list, natural index);
 void linkedListTransverse(linkedList_t *list);
 
+/******************************************************************************
+ * BULK FUNCTIONS                                                             *
+ ******************************************************************************/
+
+linkedList_t *linkedListFromArray(const real *array, natural size);
+real *linkedListToArray(const linkedList_t *list, natural *size);
+natural linkedListCopyInto(const linkedList_t *list, real *buffer, 
+                           natural capacity);
+
+/******************************************************************************
+ * LIST HANDLE FUNCTIONS                                                      *
+ ******************************************************************************/
+
+void linkedListHandleInit(linkedListHandle_t *handle);
+void linkedListHandleInitWith(linkedListHandle_t *handle, 
+                              const linkedListAllocator_t *allocator);
+void linkedListHandleFree(linkedListHandle_t *handle);
+natural linkedListHandleSize(const linkedListHandle_t *handle);
+void linkedListHandlePrepend(linkedListHandle_t *handle, real data);
+void linkedListHandleAppend(linkedListHandle_t *handle, real data);
+void linkedListHandleAppendArray(linkedListHandle_t *handle, const real *array,
+                                 natural size);
+void linkedListHandleAddByIndex(linkedListHandle_t *handle, real data, 
+                                natural index);
+real linkedListHandlePopFront(linkedListHandle_t *handle);
+void linkedListHandleRemoveLast(linkedListHandle_t *handle);
+void linkedListHandleRemoveByIndex(linkedListHandle_t *handle, natural index);
+void linkedListHandleSet(linkedListHandle_t *handle, real data, natural index);
+real linkedListHandleGet(linkedListHandle_t *handle, natural index);
+void linkedListHandleTransverse(const linkedListHandle_t *handle);
+
+/******************************************************************************
+ * CURSOR FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void linkedListCursorBegin(linkedListCursor_t *cursor, 
+                           linkedListHandle_t *handle);
+int linkedListCursorValid(const linkedListCursor_t *cursor);
+void linkedListCursorNext(linkedListCursor_t *cursor);
+void linkedListCursorSeek(linkedListCursor_t *cursor, natural index);
+real linkedListCursorGet(const linkedListCursor_t *cursor);
+void linkedListCursorSet(linkedListCursor_t *cursor, real data);
+void linkedListCursorInsertAfter(linkedListCursor_t *cursor, real data);
+void linkedListCursorErase(linkedListCursor_t *cursor);
+
+/******************************************************************************
+ * BATCH FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void linkedListApply(linkedList_t **list, const linkedListEdit_t *edits, 
+                     natural count);
+void linkedListHandleApply(linkedListHandle_t *handle, 
+                           const linkedListEdit_t *edits, natural count);
+
 #endif
 /*****END*****/
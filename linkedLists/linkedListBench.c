@@ -0,0 +1,937 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                       LINKED LISTS BENCHMARK SUITE                         *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListBench [--max-size N] [--format csv|json]                  *
+ *                        [--variant NAME] [--budget-ms MS] [--stats FILE]    *
+ *                                                                            *
+ * Times every operation of linkedList.h (New, AddBegin, AddEnd, AddByIndex,  *
+ * RemoveLast, RemoveFirst, RemoveByIndex, Get, Set and Transverse) on lists  *
+ * of 10, 100, ..., up to 10^7 nodes. The index-based operations run with     *
+ * three access patterns:                                                     *
+ *                                                                            *
+ *  - sequential : indexes 0, 1, 2, ... (wrapping around).                    *
+ *  - random     : uniform indexes over the whole list.                       *
+ *  - head       : uniform indexes over the first 1% of the list.             *
+ *                                                                            *
+ * A sample times a batch of operations, as many as it takes for the batch   *
+ * to last BENCH_SAMPLE_NS (up to BENCH_MAX_BATCH, and half the list for the  *
+ * removals), so that the clock resolution and the cost of reading it do not *
+ * show. The cost of the same loop with an empty call is taken out, and the   *
+ * 50/90/99 percentiles are those of the batch means.                         *
+ *                                                                            *
+ * The list size is kept about constant: the timed additions of a batch are  *
+ * undone by untimed removals, and the other way around. Each cell is sampled *
+ * until its time budget is spent (with 5 samples at least), and one line is  *
+ * written per cell, with the mean ns/op, the percentiles and the allocations *
+ * and frees per operation. These count the calls to malloc, aligned_alloc   *
+ * and free, which the build wraps with -Wl,--wrap (LINKEDLIST_BENCH_WRAP),   *
+ * so the lists with a node pool (linkedListPool.h) only count the chunks it  *
+ * takes. Where the linker cannot wrap, they are reported as empty/null.      *
+ *                                                                            *
+ * The same operations are run on every list variant, so each one can be     *
+ * compared with the baseline (the bare linkedList_t functions).              *
+ *                                                                            *
+ * With --stats, the instrumentation counters of the whole run are written   *
+ * into FILE (see linkedListInstrument.h; LINKEDLIST_INSTRUMENT builds only). *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "unrolledList.h"
+#include "skipList.h"
+#include "doublyList.h"
+#include "xorList.h"
+#include "linkedListGeneric.h"
+#include "linkedListInstrument.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define BENCH_MIN_SAMPLES 5
+#define BENCH_MAX_SAMPLES 100000
+/*Operations timed together, and the time a batch should last at least*/
+#define BENCH_MAX_BATCH   1024
+#define BENCH_SAMPLE_NS   2000.0
+/*Runs of the empty loop, whose median is taken out of every batch*/
+#define BENCH_EMPTY_RUNS  15
+
+/******************************************************************************
+ * ALLOCATION COUNTERS                                                        *
+ ******************************************************************************
+ * With LINKEDLIST_BENCH_WRAP, the linker sends every call the program makes  *
+ * to these functions through the __wrap_ ones (the calls inside libc itself  *
+ * are left alone). The counters are volatile: the compiler takes malloc for  *
+ * the builtin one, which would leave them alone.                             *
+ ******************************************************************************/
+static volatile unsigned long long benchAllocs = 0;
+static volatile unsigned long long benchFrees  = 0;
+
+#ifdef LINKEDLIST_BENCH_WRAP
+
+void *__real_malloc(size_t size);
+void *__real_aligned_alloc(size_t alignment, size_t size);
+void  __real_free(void *block);
+
+void *__wrap_malloc(size_t size)
+{
+    benchAllocs++;
+    return __real_malloc(size);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size)
+{
+    benchAllocs++;
+    return __real_aligned_alloc(alignment, size);
+}
+
+void __wrap_free(void *block)
+{
+    if (block != NULL) benchFrees++;
+    __real_free(block);
+}
+
+#endif
+
+/******************************************************************************
+ * VARIANTS                                                                   *
+ ******************************************************************************
+ * Every list variant is driven through the same table of operations.        *
+ ******************************************************************************/
+typedef struct benchVariant
+{
+    const char *name;
+    void *(*create)(void);
+    void  (*destroy)(void *list);
+    void  (*addBegin)(void *list, real data);
+    void  (*addEnd)(void *list, real data);
+    void  (*addByIndex)(void *list, real data, natural index);
+    void  (*removeLast)(void *list);
+    void  (*removeFirst)(void *list);
+    void  (*removeByIndex)(void *list, natural index);
+    void  (*set)(void *list, real data, natural index);
+    real  (*get)(void *list, natural index);
+    void  (*transverse)(void *list);
+
+} benchVariant_t;
+
+/*bare linkedList_t: the list is its head pointer*/
+static void *bareCreate(void) 
+{
+    return calloc(1, sizeof(linkedList_t*));
+}
+static void bareDestroy(void *list)
+{
+    linkedList_t **head = (linkedList_t**) list;
+    while(*head != NULL) linkedListRemoveFirst(head);
+    free(head);
+}
+static void bareAddBegin(void *list, real data)
+{
+    linkedListAddBegin((linkedList_t**) list, data);
+}
+static void bareAddEnd(void *list, real data)
+{
+    linkedList_t **head = (linkedList_t**) list;
+    if (*head == NULL) *head = linkedListNew(data);
+    else               linkedListAddEnd(*head, data);
+}
+static void bareAddByIndex(void *list, real data, natural index)
+{
+    linkedListAddByIndex((linkedList_t**) list, data, index);
+}
+static void bareRemoveLast(void *list)
+{
+    linkedListRemoveLast(*(linkedList_t**) list);
+}
+static void bareRemoveFirst(void *list)
+{
+    linkedListRemoveFirst((linkedList_t**) list);
+}
+static void bareRemoveByIndex(void *list, natural index)
+{
+    linkedListRemoveByIndex((linkedList_t**) list, index);
+}
+static void bareSet(void *list, real data, natural index)
+{
+    linkedListSet(*(linkedList_t**) list, data, index);
+}
+static real bareGet(void *list, natural index)
+{
+    return linkedListGet(*(linkedList_t**) list, index);
+}
+static void bareTransverse(void *list)
+{
+    linkedListTransverse(*(linkedList_t**) list);
+}
+
+/*linkedListHandle_t*/
+static void *handleCreate(void)
+{
+    linkedListHandle_t *handle = 
+        (linkedListHandle_t*) malloc(sizeof(linkedListHandle_t));
+    linkedListHandleInit(handle);
+    return handle;
+}
+static void handleDestroy(void *list)
+{
+    linkedListHandleFree((linkedListHandle_t*) list);
+    free(list);
+}
+static void handleAddBegin(void *list, real data)
+{
+    linkedListHandlePrepend((linkedListHandle_t*) list, data);
+}
+static void handleAddEnd(void *list, real data)
+{
+    linkedListHandleAppend((linkedListHandle_t*) list, data);
+}
+static void handleAddByIndex(void *list, real data, natural index)
+{
+    linkedListHandleAddByIndex((linkedListHandle_t*) list, data, index);
+}
+static void handleRemoveLast(void *list)
+{
+    linkedListHandleRemoveLast((linkedListHandle_t*) list);
+}
+static void handleRemoveFirst(void *list)
+{
+    linkedListHandlePopFront((linkedListHandle_t*) list);
+}
+static void handleRemoveByIndex(void *list, natural index)
+{
+    linkedListHandleRemoveByIndex((linkedListHandle_t*) list, index);
+}
+static void handleSet(void *list, real data, natural index)
+{
+    linkedListHandleSet((linkedListHandle_t*) list, data, index);
+}
+static real handleGet(void *list, natural index)
+{
+    return linkedListHandleGet((linkedListHandle_t*) list, index);
+}
+static void handleTransverse(void *list)
+{
+    linkedListHandleTransverse((linkedListHandle_t*) list);
+}
+
+/*unrolledList_t*/
+static void *unrolledCreate(void)
+{
+    unrolledList_t *list = (unrolledList_t*) malloc(sizeof(unrolledList_t));
+    unrolledListInit(list);
+    return list;
+}
+static void unrolledDestroy(void *list)
+{
+    unrolledListFree((unrolledList_t*) list);
+    free(list);
+}
+static void unrolledAddBegin(void *list, real data)
+{
+    unrolledListAddBegin((unrolledList_t*) list, data);
+}
+static void unrolledAddEnd(void *list, real data)
+{
+    unrolledListAddEnd((unrolledList_t*) list, data);
+}
+static void unrolledAddByIndex(void *list, real data, natural index)
+{
+    unrolledListAddByIndex((unrolledList_t*) list, data, index);
+}
+static void unrolledRemoveLast(void *list)
+{
+    unrolledListRemoveLast((unrolledList_t*) list);
+}
+static void unrolledRemoveFirst(void *list)
+{
+    unrolledListRemoveFirst((unrolledList_t*) list);
+}
+static void unrolledRemoveByIndex(void *list, natural index)
+{
+    unrolledListRemoveByIndex((unrolledList_t*) list, index);
+}
+static void unrolledSet(void *list, real data, natural index)
+{
+    unrolledListSet((unrolledList_t*) list, data, index);
+}
+static real unrolledGet(void *list, natural index)
+{
+    return unrolledListGet((unrolledList_t*) list, index);
+}
+static void unrolledTransverse(void *list)
+{
+    unrolledListTransverse((unrolledList_t*) list);
+}
+
+/*skipList_t*/
+static void *skipCreate(void)
+{
+    skipList_t *list = (skipList_t*) malloc(sizeof(skipList_t));
+    skipListInit(list);
+    return list;
+}
+static void skipDestroy(void *list)
+{
+    skipListFree((skipList_t*) list);
+    free(list);
+}
+static void skipAddBegin(void *list, real data)
+{
+    skipListAddBegin((skipList_t*) list, data);
+}
+static void skipAddEnd(void *list, real data)
+{
+    skipListAddEnd((skipList_t*) list, data);
+}
+static void skipAddByIndex(void *list, real data, natural index)
+{
+    skipListAddByIndex((skipList_t*) list, data, index);
+}
+static void skipRemoveLast(void *list)
+{
+    skipListRemoveLast((skipList_t*) list);
+}
+static void skipRemoveFirst(void *list)
+{
+    skipListRemoveFirst((skipList_t*) list);
+}
+static void skipRemoveByIndex(void *list, natural index)
+{
+    skipListRemoveByIndex((skipList_t*) list, index);
+}
+static void skipSet(void *list, real data, natural index)
+{
+    skipListSet((skipList_t*) list, data, index);
+}
+static real skipGet(void *list, natural index)
+{
+    return skipListGet((skipList_t*) list, index);
+}
+static void skipTransverse(void *list)
+{
+    skipListTransverse((skipList_t*) list);
+}
+
+/*doublyList_t*/
+static void *doublyCreate(void)
+{
+    doublyList_t *list = (doublyList_t*) malloc(sizeof(doublyList_t));
+    doublyListInit(list);
+    return list;
+}
+static void doublyDestroy(void *list)
+{
+    doublyListFree((doublyList_t*) list);
+    free(list);
+}
+static void doublyAddBegin(void *list, real data)
+{
+    doublyListAddBegin((doublyList_t*) list, data);
+}
+static void doublyAddEnd(void *list, real data)
+{
+    doublyListAddEnd((doublyList_t*) list, data);
+}
+static void doublyAddByIndex(void *list, real data, natural index)
+{
+    doublyListAddByIndex((doublyList_t*) list, data, index);
+}
+static void doublyRemoveLast(void *list)
+{
+    doublyListRemoveLast((doublyList_t*) list);
+}
+static void doublyRemoveFirst(void *list)
+{
+    doublyListRemoveFirst((doublyList_t*) list);
+}
+static void doublyRemoveByIndex(void *list, natural index)
+{
+    doublyListRemoveByIndex((doublyList_t*) list, index);
+}
+static void doublySet(void *list, real data, natural index)
+{
+    doublyListSet((doublyList_t*) list, data, index);
+}
+static real doublyGet(void *list, natural index)
+{
+    return doublyListGet((doublyList_t*) list, index);
+}
+static void doublyTransverse(void *list)
+{
+    doublyListTransverse((doublyList_t*) list);
+}
+
+/*xorList_t*/
+static void *xorCreate(void)
+{
+    xorList_t *list = (xorList_t*) malloc(sizeof(xorList_t));
+    xorListInit(list);
+    return list;
+}
+static void xorDestroy(void *list)
+{
+    xorListFree((xorList_t*) list);
+    free(list);
+}
+static void xorAddBegin(void *list, real data)
+{
+    xorListAddBegin((xorList_t*) list, data);
+}
+static void xorAddEnd(void *list, real data)
+{
+    xorListAddEnd((xorList_t*) list, data);
+}
+static void xorAddByIndex(void *list, real data, natural index)
+{
+    xorListAddByIndex((xorList_t*) list, data, index);
+}
+static void xorRemoveLast(void *list)
+{
+    xorListRemoveLast((xorList_t*) list);
+}
+static void xorRemoveFirst(void *list)
+{
+    xorListRemoveFirst((xorList_t*) list);
+}
+static void xorRemoveByIndex(void *list, natural index)
+{
+    xorListRemoveByIndex((xorList_t*) list, index);
+}
+static void xorSet(void *list, real data, natural index)
+{
+    xorListSet((xorList_t*) list, data, index);
+}
+static real xorGet(void *list, natural index)
+{
+    return xorListGet((xorList_t*) list, index);
+}
+static void xorTransverse(void *list)
+{
+    xorListTransverse((xorList_t*) list);
+}
+
+/*benchList_t, generated by LINKED_LIST_DEFINE: values go by address*/
+LINKED_LIST_DEFINE(benchList, real)
+
+static void *genericCreate(void)
+{
+    benchList_t *list = (benchList_t*) malloc(sizeof(benchList_t));
+    benchListInit(list);
+    return list;
+}
+static void genericDestroy(void *list)
+{
+    benchListFree((benchList_t*) list);
+    free(list);
+}
+static void genericAddBegin(void *list, real data)
+{
+    benchListAddBegin((benchList_t*) list, &data);
+}
+static void genericAddEnd(void *list, real data)
+{
+    benchListAddEnd((benchList_t*) list, &data);
+}
+static void genericAddByIndex(void *list, real data, natural index)
+{
+    benchListAddByIndex((benchList_t*) list, &data, index);
+}
+static void genericRemoveLast(void *list)
+{
+    benchListRemoveLast((benchList_t*) list);
+}
+static void genericRemoveFirst(void *list)
+{
+    benchListRemoveFirst((benchList_t*) list);
+}
+static void genericRemoveByIndex(void *list, natural index)
+{
+    benchListRemoveByIndex((benchList_t*) list, index);
+}
+static void genericSet(void *list, real data, natural index)
+{
+    benchListSet((benchList_t*) list, &data, index);
+}
+static real genericGet(void *list, natural index)
+{
+    real *data = benchListGet((benchList_t*) list, index);
+    return (data != NULL) ? *data : -1;
+}
+static void genericPrint(real *data, void *context)
+{
+    (void) context;
+    printf(" %1.1f", *data);
+}
+static void genericTransverse(void *list)
+{
+    printf("linkedList::[");
+    benchListForEach((benchList_t*) list, genericPrint, NULL);
+    printf(" ]\n");
+}
+
+static const benchVariant_t benchVariants[] =
+{
+    { "linkedList", bareCreate, bareDestroy, bareAddBegin, bareAddEnd,
+      bareAddByIndex, bareRemoveLast, bareRemoveFirst, bareRemoveByIndex,
+      bareSet, bareGet, bareTransverse },
+    { "handle", handleCreate, handleDestroy, handleAddBegin, handleAddEnd,
+      handleAddByIndex, handleRemoveLast, handleRemoveFirst,
+      handleRemoveByIndex, handleSet, handleGet, handleTransverse },
+    { "unrolled", unrolledCreate, unrolledDestroy, unrolledAddBegin,
+      unrolledAddEnd, unrolledAddByIndex, unrolledRemoveLast,
+      unrolledRemoveFirst, unrolledRemoveByIndex, unrolledSet, unrolledGet,
+      unrolledTransverse },
+    { "skipList", skipCreate, skipDestroy, skipAddBegin, skipAddEnd,
+      skipAddByIndex, skipRemoveLast, skipRemoveFirst, skipRemoveByIndex,
+      skipSet, skipGet, skipTransverse },
+    { "doubly", doublyCreate, doublyDestroy, doublyAddBegin, doublyAddEnd,
+      doublyAddByIndex, doublyRemoveLast, doublyRemoveFirst,
+      doublyRemoveByIndex, doublySet, doublyGet, doublyTransverse },
+    { "xor", xorCreate, xorDestroy, xorAddBegin, xorAddEnd, xorAddByIndex,
+      xorRemoveLast, xorRemoveFirst, xorRemoveByIndex, xorSet, xorGet,
+      xorTransverse },
+    { "generic", genericCreate, genericDestroy, genericAddBegin,
+      genericAddEnd, genericAddByIndex, genericRemoveLast, genericRemoveFirst,
+      genericRemoveByIndex, genericSet, genericGet, genericTransverse },
+};
+
+#define BENCH_VARIANTS (sizeof(benchVariants) / sizeof(benchVariants[0]))
+
+/******************************************************************************
+ * OPERATIONS AND PATTERNS                                                    *
+ ******************************************************************************/
+typedef enum benchOperation
+{
+    BENCH_NEW = 0,
+    BENCH_ADD_BEGIN,
+    BENCH_ADD_END,
+    BENCH_ADD_BY_INDEX,
+    BENCH_REMOVE_LAST,
+    BENCH_REMOVE_FIRST,
+    BENCH_REMOVE_BY_INDEX,
+    BENCH_GET,
+    BENCH_SET,
+    BENCH_TRANSVERSE,
+    BENCH_OPERATIONS
+
+} benchOperation_t;
+
+static const char *benchOperationNames[BENCH_OPERATIONS] =
+{
+    "New", "AddBegin", "AddEnd", "AddByIndex", "RemoveLast", "RemoveFirst",
+    "RemoveByIndex", "Get", "Set", "Transverse"
+};
+
+typedef enum benchPattern
+{
+    BENCH_SEQUENTIAL = 0,
+    BENCH_RANDOM,
+    BENCH_HEAD,
+    BENCH_PATTERNS
+
+} benchPattern_t;
+
+static const char *benchPatternNames[BENCH_PATTERNS] =
+{
+    "sequential", "random", "head"
+};
+
+static int benchIndexed(benchOperation_t operation)
+{
+    return operation == BENCH_ADD_BY_INDEX || 
+           operation == BENCH_REMOVE_BY_INDEX ||
+           operation == BENCH_GET || operation == BENCH_SET;
+}
+
+/*xorshift64, with a fixed seed, so every run draws the same indexes*/
+static unsigned long long benchState = 88172645463325252ULL;
+
+static unsigned long long benchRandom(void)
+{
+    benchState ^= benchState << 13;
+    benchState ^= benchState >> 7;
+    benchState ^= benchState << 17;
+    return benchState;
+}
+
+static natural benchIndex(benchPattern_t pattern, natural size, natural step)
+{
+    natural head = (size >= 100) ? size / 100 : 1;
+
+    switch(pattern)
+    {
+        case BENCH_SEQUENTIAL: return step % size;
+        case BENCH_RANDOM:     return (natural) (benchRandom() % size);
+        default:               return (natural) (benchRandom() % head);
+    }
+}
+
+static double benchNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static int benchCompare(const void *first, const void *second)
+{
+    double a = *(const double*) first, b = *(const double*) second;
+
+    return (a > b) - (a < b);
+}
+
+/*Transverse prints every node: its output is thrown away while timing*/
+static int benchSilence(void)
+{
+    int saved = dup(STDOUT_FILENO);
+    int null  = open("/dev/null", O_WRONLY);
+
+    fflush(stdout);
+    dup2(null, STDOUT_FILENO);
+    close(null);
+
+    return saved;
+}
+
+static void benchRestore(int saved)
+{
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+/******************************************************************************
+ * CELL                                                                       *
+ ******************************************************************************
+ * Runs one operation, on one list size, with one pattern, and writes a line. *
+ ******************************************************************************/
+typedef struct benchOptions
+{
+    natural     maxSize;
+    int         json;
+    const char *variant;
+    double      budget;    /*nanoseconds per cell*/
+    FILE       *output;
+    const char *stats;     /*instrumentation counters file*/
+
+} benchOptions_t;
+
+/*The nodes made by a batch of New, and the indexes of a batch*/
+static linkedList_t *benchNodes[BENCH_MAX_BATCH];
+static natural       benchIndexes[BENCH_MAX_BATCH];
+
+/*The empty loop calls this through a pointer the compiler cannot follow*/
+static void benchIgnore(void *list, real data)
+{
+    (void) list;
+    (void) data;
+}
+static void (*volatile benchNothing)(void *list, real data) = benchIgnore;
+
+/*Median time of a loop of batch empty calls, clock reads included*/
+static double benchEmpty(natural batch)
+{
+    double runs[BENCH_EMPTY_RUNS], start;
+    register natural r, k;
+
+    for(r = 0; r < BENCH_EMPTY_RUNS; r++)
+    {
+        start = benchNow();
+        for(k = 0; k < batch; k++) benchNothing(NULL, k);
+        runs[r] = benchNow() - start;
+    }
+    qsort(runs, BENCH_EMPTY_RUNS, sizeof(double), benchCompare);
+
+    return runs[BENCH_EMPTY_RUNS / 2];
+}
+
+/*Runs a batch of the operation, and returns its time. The untimed undo runs
+  backwards, so every node goes back to its index*/
+static double benchBatch(const benchVariant_t *variant, void *list,
+                         benchOperation_t operation, natural batch,
+                         unsigned long long *allocs,
+                         unsigned long long *frees)
+{
+    unsigned long long allocsBefore = benchAllocs, freesBefore = benchFrees;
+    natural *index = benchIndexes;
+    double start, elapsed;
+    real sum = 0;
+    volatile real sink;
+    register natural k;
+
+    start = benchNow();
+    switch(operation)
+    {
+        case BENCH_NEW:
+            for(k = 0; k < batch; k++) benchNodes[k] = linkedListNew(k);
+            break;
+        case BENCH_ADD_BEGIN:
+            for(k = 0; k < batch; k++) variant->addBegin(list, k);
+            break;
+        case BENCH_ADD_END:
+            for(k = 0; k < batch; k++) variant->addEnd(list, k);
+            break;
+        case BENCH_ADD_BY_INDEX:
+            for(k = 0; k < batch; k++) variant->addByIndex(list, k, index[k]);
+            break;
+        case BENCH_REMOVE_LAST:
+            for(k = 0; k < batch; k++) variant->removeLast(list);
+            break;
+        case BENCH_REMOVE_FIRST:
+            for(k = 0; k < batch; k++) variant->removeFirst(list);
+            break;
+        case BENCH_REMOVE_BY_INDEX:
+            for(k = 0; k < batch; k++) variant->removeByIndex(list, index[k]);
+            break;
+        case BENCH_GET:
+            for(k = 0; k < batch; k++) sum += variant->get(list, index[k]);
+            break;
+        case BENCH_SET:
+            for(k = 0; k < batch; k++) variant->set(list, k, index[k]);
+            break;
+        default:
+            for(k = 0; k < batch; k++) variant->transverse(list);
+            break;
+    }
+    elapsed = benchNow() - start;
+    sink = sum;
+    (void) sink;
+
+    *allocs += benchAllocs - allocsBefore;
+    *frees  += benchFrees - freesBefore;
+
+    for(k = batch; k-- > 0;)
+    {
+        switch(operation)
+        {
+            case BENCH_NEW:          linkedListRemoveFirst(&benchNodes[k]);
+                                     break;
+            case BENCH_ADD_BEGIN:    variant->removeFirst(list);       break;
+            case BENCH_ADD_END:      variant->removeLast(list);        break;
+            case BENCH_ADD_BY_INDEX: variant->removeByIndex(list, index[k]);
+                                     break;
+            case BENCH_REMOVE_LAST:  variant->addEnd(list, k);         break;
+            case BENCH_REMOVE_FIRST: variant->addBegin(list, k);       break;
+            case BENCH_REMOVE_BY_INDEX:
+                variant->addByIndex(list, k, index[k]);
+                break;
+            default: break;
+        }
+    }
+
+    return elapsed;
+}
+
+static void benchCell(const benchOptions_t *options,
+                      const benchVariant_t *variant, void *list,
+                      natural size, benchOperation_t operation,
+                      benchPattern_t pattern, double *samples)
+{
+    unsigned long long allocs = 0, frees = 0, ignored = 0;
+    double elapsed, empty, total = 0, spent = 0, start;
+    natural count = 0, step = 0, batch, limit = BENCH_MAX_BATCH, range = size;
+    int shrinks = operation == BENCH_REMOVE_LAST ||
+                  operation == BENCH_REMOVE_FIRST ||
+                  operation == BENCH_REMOVE_BY_INDEX;
+    int saved = -1;
+    register natural k;
+
+    if (operation == BENCH_TRANSVERSE) saved = benchSilence();
+
+    /*a batch of removals takes half the list at most, and their indexes
+      stay below what is left*/
+    if (shrinks && limit > size / 2) limit = size / 2;
+    if (shrinks) range = size - limit;
+
+    /*the batch doubles until it lasts BENCH_SAMPLE_NS, which warms up too*/
+    for(batch = 1; ; batch *= 2)
+    {
+        if (batch >= limit) batch = limit;
+        for(k = 0; k < batch; k++)
+        {
+            benchIndexes[k] = benchIndex(pattern, range, step++);
+        }
+        if (benchBatch(variant, list, operation, batch, &ignored,
+                       &ignored) >= BENCH_SAMPLE_NS || batch == limit)
+        {
+            break;
+        }
+    }
+    empty = benchEmpty(batch);
+
+    while(count < BENCH_MAX_SAMPLES &&
+          (count < BENCH_MIN_SAMPLES || spent < options->budget))
+    {
+        start = benchNow();
+        for(k = 0; k < batch; k++)
+        {
+            benchIndexes[k] = benchIndex(pattern, range, step++);
+        }
+
+        elapsed = benchBatch(variant, list, operation, batch, &allocs,
+                             &frees) - empty;
+        if (elapsed < 0) elapsed = 0;
+
+        samples[count++] = elapsed / batch;
+        total += elapsed;
+        spent += benchNow() - start;
+    }
+
+    if (saved >= 0) benchRestore(saved);
+
+    qsort(samples, count, sizeof(double), benchCompare);
+    double p50 = samples[(count - 1) * 50 / 100];
+    double p90 = samples[(count - 1) * 90 / 100];
+    double p99 = samples[(count - 1) * 99 / 100];
+    double operations = (double) count * batch;
+    const char *patternName = benchIndexed(operation)
+                            ? benchPatternNames[pattern] : "fixed";
+#ifdef LINKEDLIST_BENCH_WRAP
+    int counted = 1;
+#else
+    int counted = 0;
+#endif
+
+    if (options->json)
+    {
+        fprintf(options->output, "{\"variant\":\"%s\",\"operation\":\"%s\","
+                "\"pattern\":\"%s\",\"size\":%u,\"samples\":%u,"
+                "\"batch\":%u,\"ns_per_op\":%.1f,\"p50_ns\":%.1f,"
+                "\"p90_ns\":%.1f,\"p99_ns\":%.1f,", variant->name,
+                benchOperationNames[operation], patternName, size, count,
+                batch, total / operations, p50, p90, p99);
+        if (counted)
+        {
+            fprintf(options->output, "\"allocs_per_op\":%.3f,"
+                    "\"frees_per_op\":%.3f}\n",
+                    (double) allocs / operations, (double) frees / operations);
+        }
+        else
+        {
+            fprintf(options->output,
+                    "\"allocs_per_op\":null,\"frees_per_op\":null}\n");
+        }
+    }
+    else
+    {
+        fprintf(options->output, "%s,%s,%s,%u,%u,%u,%.1f,%.1f,%.1f,%.1f,",
+                variant->name, benchOperationNames[operation], patternName,
+                size, count, batch, total / operations, p50, p90, p99);
+        if (counted)
+        {
+            fprintf(options->output, "%.3f,%.3f\n",
+                    (double) allocs / operations, (double) frees / operations);
+        }
+        else
+        {
+            fprintf(options->output, ",\n");
+        }
+    }
+    fflush(options->output);
+}
+
+static void benchVariant(const benchOptions_t *options, 
+                         const benchVariant_t *variant, double *samples)
+{
+    natural size;
+    register natural i;
+    int operation, pattern;
+
+    for(size = 10; size <= options->maxSize; size *= 10)
+    {
+        void *list = variant->create();
+        for(i = 0; i < size; i++) variant->addBegin(list, i);
+
+        for(operation = 0; operation < BENCH_OPERATIONS; operation++)
+        {
+            /*New does not depend on the variant*/
+            if (operation == BENCH_NEW && variant != &benchVariants[0]) 
+            {
+                continue;
+            }
+
+            for(pattern = 0; pattern < BENCH_PATTERNS; pattern++)
+            {
+                if (!benchIndexed(operation) && pattern > 0) break;
+
+                benchCell(options, variant, list, size, operation, pattern,
+                          samples);
+            }
+        }
+
+        variant->destroy(list);
+        if (size > options->maxSize / 10) break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchOptions_t options = { 10000000, 0, NULL, 20e6, stdout, NULL };
+    register int i;
+    register natural v;
+
+    for(i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc)
+        {
+            options.maxSize = (natural) strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            options.json = (strcmp(argv[++i], "json") == 0);
+        }
+        else if (strcmp(argv[i], "--variant") == 0 && i + 1 < argc)
+        {
+            options.variant = argv[++i];
+        }
+        else if (strcmp(argv[i], "--budget-ms") == 0 && i + 1 < argc)
+        {
+            options.budget = atof(argv[++i]) * 1e6;
+        }
+        else if (strcmp(argv[i], "--stats") == 0 && i + 1 < argc)
+        {
+            options.stats = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--max-size N] [--format csv|json] "
+                    "[--variant NAME] [--budget-ms MS] [--stats FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (options.maxSize < 10) options.maxSize = 10;
+
+    double *samples = (double*) malloc(BENCH_MAX_SAMPLES * sizeof(double));
+
+    if (!options.json)
+    {
+        fprintf(options.output, "variant,operation,pattern,size,samples,"
+                "batch,ns_per_op,p50_ns,p90_ns,p99_ns,allocs_per_op,"
+                "frees_per_op\n");
+    }
+    for(v = 0; v < BENCH_VARIANTS; v++)
+    {
+        if (options.variant != NULL && 
+            strcmp(options.variant, benchVariants[v].name) != 0) continue;
+
+        benchVariant(&options, &benchVariants[v], samples);
+    }
+
+    free(samples);
+
+    /*the counters only exist in LINKEDLIST_INSTRUMENT builds*/
+    if (options.stats != NULL && !linkedListStatsExport(options.stats)) return 1;
+
+    return 0;
+}
@@ -0,0 +1,981 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                  LINKED LISTS DIFFERENTIAL CHECK AND FUZZER                *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListCheck [seed] [runs] [operations]                          *
+ *        linkedListCheck --replay FILE...                                    *
+ *                                                                            *
+ * Every list variant runs the same sequence of operations as a plain array,  *
+ * the reference model, and must hold the same values after each of them:    *
+ * the sizes are compared after every operation, Get results as they come,    *
+ * and the whole contents on every check operation and at the end.            *
+ *                                                                            *
+ * A sequence is decoded from bytes, three per operation (operation, index   *
+ * and value). The indexes reach past the end of the list, where Get gives   *
+ * -1, Set and RemoveByIndex do nothing, and AddByIndex appends.              *
+ *                                                                            *
+ * An Apply operation takes the next one to four operations as the edits of a *
+ * batch, which often share an index. The lists with a batch function (the    *
+ * bare list and the handles) apply it at once; the others, and the model,    *
+ * get the single operations it amounts to, from the last position to the    *
+ * first. The contents are compared after every batch, and the size of a      *
+ * handle is only given while its tail is the last node.                      *
+ *                                                                            *
+ * The cursor operations (InsertAfter, Erase and Set at an index) go through  *
+ * a cursor of the handles, sought from the middle of the list, right after   *
+ * a Get of the next index has left it in the cache of the handle. The other  *
+ * lists, and the model, get the single operation they amount to (none past   *
+ * the end), and the values at the index and the next one are compared.       *
+ *                                                                            *
+ * By default, runs random sequences of the given number of operations are   *
+ * checked, and the exit code is 1 on the first difference, which is written *
+ * to stderr with its seed, run and operation. With --replay, the files are   *
+ * checked as sequences (e.g., the inputs saved by the fuzzer).               *
+ *                                                                            *
+ * Compiled with LINKEDLIST_FUZZ defined (the CMake option of the same name,  *
+ * with Clang), this file is the libFuzzer entry point instead, and the first *
+ * difference aborts.                                                         *
+ *                                                                            *
+ * The error messages of the lists go to stdout, which is sent to /dev/null.  *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+#include "unrolledList.h"
+#include "skipList.h"
+#include "doublyList.h"
+#include "xorList.h"
+#include "linkedListGeneric.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/*Additions are skipped beyond this size, to keep the checks quick*/
+#define CHECK_MAX_SIZE 512
+/*Bytes decoded per operation*/
+#define CHECK_OPERATION_BYTES 3
+/*Edits in a batch*/
+#define CHECK_MAX_EDITS 4
+
+LINKED_LIST_DEFINE(checkList, real)
+
+/*A value owning its text, so that COPY and DESTROY have real work to do:
+  the values alive must always be the ones in the list*/
+typedef struct checkText
+{
+    char *text;
+
+} checkText_t;
+
+static long checkTextLive = 0;
+
+static void checkTextCopy(checkText_t *dst, const checkText_t *src)
+{
+    size_t length = strlen(src->text) + 1;
+
+    dst->text = (char*) malloc(length);
+    memcpy(dst->text, src->text, length);
+    checkTextLive++;
+}
+
+static void checkTextDestroy(checkText_t *value)
+{
+    free(value->text);
+    value->text = NULL;
+    checkTextLive--;
+}
+
+static int checkTextCompare(const checkText_t *a, const checkText_t *b)
+{
+    return strcmp(a->text, b->text);
+}
+
+LINKED_LIST_DEFINE_WITH(checkTextList, checkText_t, checkTextCopy,
+                        checkTextDestroy, checkTextCompare)
+
+typedef enum checkOperation
+{
+    CHECK_ADD_BEGIN = 0,
+    CHECK_ADD_END,
+    CHECK_ADD_BY_INDEX,
+    CHECK_REMOVE_LAST,
+    CHECK_REMOVE_FIRST,
+    CHECK_REMOVE_BY_INDEX,
+    CHECK_SET,
+    CHECK_GET,
+    CHECK_APPLY,
+    CHECK_CURSOR_INSERT,
+    CHECK_CURSOR_ERASE,
+    CHECK_CURSOR_SET,
+    CHECK_CONTENTS,
+    CHECK_OPERATIONS
+
+} checkOperation_t;
+
+static const char *checkOperationNames[CHECK_OPERATIONS] =
+{
+    "AddBegin", "AddEnd", "AddByIndex", "RemoveLast", "RemoveFirst",
+    "RemoveByIndex", "Set", "Get", "Apply", "CursorInsertAfter", "CursorErase",
+    "CursorSet", "contents"
+};
+
+/*One operation of the ones a batch amounts to*/
+typedef struct checkSingle
+{
+    checkOperation_t operation;
+    natural          index;
+    real             data;
+
+} checkSingle_t;
+
+/******************************************************************************
+ * REFERENCE MODEL                                                            *
+ ******************************************************************************/
+typedef struct checkModel
+{
+    real    values[CHECK_MAX_SIZE];
+    natural size;
+
+} checkModel_t;
+
+static void checkModelApply(checkModel_t *model, checkOperation_t operation,
+                            natural index, real data)
+{
+    switch(operation)
+    {
+        case CHECK_ADD_BEGIN:
+            index = 0;
+            /*fall through*/
+        case CHECK_ADD_END:
+        case CHECK_ADD_BY_INDEX:
+            if (operation == CHECK_ADD_END || index > model->size)
+            {
+                index = model->size;
+            }
+            memmove(&model->values[index + 1], &model->values[index],
+                    (model->size - index) * sizeof(real));
+            model->values[index] = data;
+            model->size++;
+            break;
+
+        case CHECK_REMOVE_LAST:
+            if (model->size > 0) model->size--;
+            break;
+
+        case CHECK_REMOVE_FIRST:
+            index = 0;
+            /*fall through*/
+        case CHECK_REMOVE_BY_INDEX:
+            if (index >= model->size) break;
+            memmove(&model->values[index], &model->values[index + 1],
+                    (model->size - index - 1) * sizeof(real));
+            model->size--;
+            break;
+
+        case CHECK_SET:
+            if (index < model->size) model->values[index] = data;
+            break;
+
+        default:
+            break;
+    }
+}
+
+static real checkModelGet(const checkModel_t *model, natural index)
+{
+    return (index < model->size) ? model->values[index] : -1;
+}
+
+/*The operation a cursor operation amounts to at an index of a list of the
+  given size: CHECK_GET, which changes nothing, past the end*/
+static checkOperation_t checkModelCursor(checkOperation_t operation,
+                                         natural *index, natural size)
+{
+    if (*index >= size) return CHECK_GET;
+
+    switch(operation)
+    {
+        case CHECK_CURSOR_INSERT:
+            (*index)++;
+            return CHECK_ADD_BY_INDEX;
+        case CHECK_CURSOR_ERASE:
+            return CHECK_REMOVE_BY_INDEX;
+        default:
+            return CHECK_SET;
+    }
+}
+
+/*Writes the single operations a batch of edits amounts to on a list of the
+  given size, and returns how many. The positions go from the end (where the
+  insertions beyond it go) to the first one, so that the ones still to come
+  keep their index: the node at a position is removed if any edit removes
+  it, or takes the value of its last Set before a removal; the insertions at
+  that position then go in front of it, the last one first.*/
+static natural checkModelBatch(const linkedListEdit_t *edits, natural count,
+                               natural size, checkSingle_t *singles)
+{
+    const linkedListEdit_t *inserts[CHECK_MAX_EDITS], *edit;
+    natural total = 0, found, position, i, j;
+    int removed, set;
+    real data = 0;
+
+    for(position = size + 1; position-- > 0;)
+    {
+        removed = set = 0;
+        found = 0;
+        for(i = 0; i < count; i++)
+        {
+            edit = &edits[i];
+            if (edit->op == LINKED_LIST_EDIT_INSERT)
+            {
+                /*beyond the end, in the order of their indexes*/
+                if (edit->index != position &&
+                    (position < size || edit->index < size))
+                {
+                    continue;
+                }
+                for(j = found; j > 0 && inserts[j - 1]->index > edit->index;
+                    j--)
+                {
+                    inserts[j] = inserts[j - 1];
+                }
+                inserts[j] = edit;
+                found++;
+            }
+            else if (edit->index == position && position < size && !removed)
+            {
+                if (edit->op == LINKED_LIST_EDIT_REMOVE) removed = 1;
+                else
+                {
+                    set  = 1;
+                    data = edit->data;
+                }
+            }
+        }
+
+        if (removed)
+        {
+            singles[total++] = (checkSingle_t) { CHECK_REMOVE_BY_INDEX,
+                                                 position, 0 };
+        }
+        else if (set)
+        {
+            singles[total++] = (checkSingle_t) { CHECK_SET, position, data };
+        }
+        while(found > 0)
+        {
+            singles[total++] = (checkSingle_t) { CHECK_ADD_BY_INDEX, position,
+                                                 inserts[--found]->data };
+        }
+    }
+
+    return total;
+}
+
+/******************************************************************************
+ * LIST VARIANTS                                                              *
+ ******************************************************************************
+ * Each variant is driven through the same calls. The bare linkedList_t needs *
+ * its head pointer for an empty list, as the benchmark does: AddEnd starts   *
+ * an empty list with linkedListNew, and RemoveLast of a single node is a     *
+ * RemoveFirst.                                                               *
+ ******************************************************************************/
+typedef struct checkVariant
+{
+    const char *name;
+    void   *(*create)(void);
+    void    (*destroy)(void *list);
+    natural (*size)(void *list);
+    void    (*apply)(void *list, checkOperation_t operation, natural index,
+                     real data);
+    real    (*get)(void *list, natural index);
+    /*NULL: the batch goes to apply as single operations*/
+    void    (*batch)(void *list, const linkedListEdit_t *edits,
+                     natural count);
+    /*0: the cursor operations go to apply as single operations*/
+    int       cursors;
+
+} checkVariant_t;
+
+/*bare linkedList_t: the list is its head pointer*/
+static void *bareCreate(void)
+{
+    return calloc(1, sizeof(linkedList_t*));
+}
+static void bareDestroy(void *list)
+{
+    linkedListFree(*(linkedList_t**) list);
+    free(list);
+}
+static natural bareSize(void *list)
+{
+    const linkedList_t *current = *(linkedList_t**) list;
+    natural size = 0;
+
+    for(; current != NULL; current = current->next) size++;
+
+    return size;
+}
+static void bareApply(void *list, checkOperation_t operation, natural index,
+                      real data)
+{
+    linkedList_t **head = (linkedList_t**) list;
+
+    switch(operation)
+    {
+        case CHECK_ADD_BEGIN:    linkedListAddBegin(head, data);           break;
+        case CHECK_ADD_BY_INDEX: linkedListAddByIndex(head, data, index);  break;
+        case CHECK_REMOVE_FIRST: linkedListRemoveFirst(head);              break;
+        case CHECK_REMOVE_BY_INDEX: linkedListRemoveByIndex(head, index);  break;
+        case CHECK_SET:          linkedListSet(*head, data, index);        break;
+        case CHECK_ADD_END:
+            if (*head == NULL) *head = linkedListNew(data);
+            else               linkedListAddEnd(*head, data);
+            break;
+        case CHECK_REMOVE_LAST:
+            if (*head == NULL || (*head)->next == NULL)
+            {
+                linkedListRemoveFirst(head);
+            }
+            else linkedListRemoveLast(*head);
+            break;
+        default: break;
+    }
+}
+static real bareGet(void *list, natural index)
+{
+    return linkedListGet(*(linkedList_t**) list, index);
+}
+static void bareBatch(void *list, const linkedListEdit_t *edits,
+                      natural count)
+{
+    linkedListApply((linkedList_t**) list, edits, count);
+}
+
+/*linkedListHandle_t, on the default allocator or on a pool*/
+typedef struct checkHandle
+{
+    linkedListHandle_t handle;
+    linkedListPool_t   pool;
+
+} checkHandle_t;
+
+static void *handleCreate(void)
+{
+    checkHandle_t *list = (checkHandle_t*) malloc(sizeof(checkHandle_t));
+    linkedListHandleInit(&list->handle);
+    return list;
+}
+static void *handlePoolCreate(void)
+{
+    checkHandle_t *list = (checkHandle_t*) malloc(sizeof(checkHandle_t));
+    linkedListPoolInit(&list->pool, 64);
+    linkedListHandleInitWith(&list->handle, linkedListPoolAllocator(&list->pool));
+    return list;
+}
+static void handleDestroy(void *list)
+{
+    linkedListHandleFree(&((checkHandle_t*) list)->handle);
+    free(list);
+}
+static void handlePoolDestroy(void *list)
+{
+    linkedListHandleFree(&((checkHandle_t*) list)->handle);
+    linkedListPoolDestroy(&((checkHandle_t*) list)->pool);
+    free(list);
+}
+/*The size is only given while the tail is the last node*/
+static natural handleSize(void *list)
+{
+    const linkedListHandle_t *handle = &((checkHandle_t*) list)->handle;
+    const linkedList_t *last = handle->head;
+
+    while(last != NULL && last->next != NULL) last = last->next;
+
+    return (handle->tail == last) ? linkedListHandleSize(handle)
+                                  : (natural) -1;
+}
+/*The seek to the index walks forward from the middle, or starts over from
+  the head. The node after the index is read first, so that the edit must
+  forget the position the handle caches*/
+static void handleCursor(linkedListHandle_t *handle,
+                         checkOperation_t operation, natural index, real data)
+{
+    linkedListCursor_t cursor;
+
+    linkedListHandleGet(handle, index + 1);
+    linkedListCursorBegin(&cursor, handle);
+    linkedListCursorSeek(&cursor, linkedListHandleSize(handle) / 2);
+    linkedListCursorSeek(&cursor, index);
+
+    switch(operation)
+    {
+        case CHECK_CURSOR_INSERT: linkedListCursorInsertAfter(&cursor, data);
+                                  break;
+        case CHECK_CURSOR_ERASE:  linkedListCursorErase(&cursor);       break;
+        case CHECK_CURSOR_SET:    linkedListCursorSet(&cursor, data);   break;
+        default: break;
+    }
+}
+static void handleApply(void *list, checkOperation_t operation, natural index,
+                        real data)
+{
+    linkedListHandle_t *handle = &((checkHandle_t*) list)->handle;
+
+    switch(operation)
+    {
+        case CHECK_ADD_BEGIN:    linkedListHandlePrepend(handle, data);    break;
+        case CHECK_ADD_END:      linkedListHandleAppend(handle, data);     break;
+        case CHECK_REMOVE_LAST:  linkedListHandleRemoveLast(handle);       break;
+        case CHECK_REMOVE_FIRST: linkedListHandlePopFront(handle);         break;
+        case CHECK_SET:          linkedListHandleSet(handle, data, index); break;
+        case CHECK_ADD_BY_INDEX:
+            linkedListHandleAddByIndex(handle, data, index);
+            break;
+        case CHECK_REMOVE_BY_INDEX:
+            linkedListHandleRemoveByIndex(handle, index);
+            break;
+        case CHECK_CURSOR_INSERT:
+        case CHECK_CURSOR_ERASE:
+        case CHECK_CURSOR_SET:
+            handleCursor(handle, operation, index, data);
+            break;
+        default: break;
+    }
+}
+static real handleGet(void *list, natural index)
+{
+    return linkedListHandleGet(&((checkHandle_t*) list)->handle, index);
+}
+static void handleBatch(void *list, const linkedListEdit_t *edits,
+                        natural count)
+{
+    linkedListHandleApply(&((checkHandle_t*) list)->handle, edits, count);
+}
+
+/*The variants with the usual set of functions*/
+#define CHECK_VARIANT(prefix, type)                                           \
+static void *prefix##Create(void)                                             \
+{                                                                             \
+    type *list = (type*) malloc(sizeof(type));                                \
+    prefix##ListInit(list);                                                   \
+    return list;                                                              \
+}                                                                             \
+static void prefix##Destroy(void *list)                                       \
+{                                                                             \
+    prefix##ListFree((type*) list);                                           \
+    free(list);                                                               \
+}                                                                             \
+static natural prefix##Size(void *list)                                       \
+{                                                                             \
+    return prefix##ListSize((type*) list);                                    \
+}                                                                             \
+static void prefix##Apply(void *list, checkOperation_t operation,             \
+                          natural index, real data)                           \
+{                                                                             \
+    switch(operation)                                                         \
+    {                                                                         \
+        case CHECK_ADD_BEGIN:                                                 \
+            prefix##ListAddBegin((type*) list, data);                         \
+            break;                                                            \
+        case CHECK_ADD_END:                                                   \
+            prefix##ListAddEnd((type*) list, data);                           \
+            break;                                                            \
+        case CHECK_ADD_BY_INDEX:                                              \
+            prefix##ListAddByIndex((type*) list, data, index);                \
+            break;                                                            \
+        case CHECK_REMOVE_LAST:                                               \
+            prefix##ListRemoveLast((type*) list);                             \
+            break;                                                            \
+        case CHECK_REMOVE_FIRST:                                              \
+            prefix##ListRemoveFirst((type*) list);                            \
+            break;                                                            \
+        case CHECK_REMOVE_BY_INDEX:                                           \
+            prefix##ListRemoveByIndex((type*) list, index);                   \
+            break;                                                            \
+        case CHECK_SET:                                                       \
+            prefix##ListSet((type*) list, data, index);                       \
+            break;                                                            \
+        default:                                                              \
+            break;                                                            \
+    }                                                                         \
+}                                                                             \
+static real prefix##Get(void *list, natural index)                            \
+{                                                                             \
+    return prefix##ListGet((type*) list, index);                              \
+}
+
+CHECK_VARIANT(unrolled, unrolledList_t)
+CHECK_VARIANT(skip, skipList_t)
+CHECK_VARIANT(doubly, doublyList_t)
+CHECK_VARIANT(xor, xorList_t)
+
+/*checkList_t, generated by LINKED_LIST_DEFINE: values go by address*/
+static void *genericCreate(void)
+{
+    checkList_t *list = (checkList_t*) malloc(sizeof(checkList_t));
+    checkListInit(list);
+    return list;
+}
+static void genericDestroy(void *list)
+{
+    checkListFree((checkList_t*) list);
+    free(list);
+}
+static natural genericSize(void *list)
+{
+    return checkListSize((checkList_t*) list);
+}
+static void genericApply(void *list, checkOperation_t operation, natural index,
+                         real data)
+{
+    checkList_t *generic = (checkList_t*) list;
+
+    switch(operation)
+    {
+        case CHECK_ADD_BEGIN:    checkListAddBegin(generic, &data);          break;
+        case CHECK_ADD_END:      checkListAddEnd(generic, &data);            break;
+        case CHECK_REMOVE_LAST:  checkListRemoveLast(generic);               break;
+        case CHECK_REMOVE_FIRST: checkListRemoveFirst(generic);              break;
+        case CHECK_SET:          checkListSet(generic, &data, index);        break;
+        case CHECK_ADD_BY_INDEX:
+            checkListAddByIndex(generic, &data, index);
+            break;
+        case CHECK_REMOVE_BY_INDEX:
+            checkListRemoveByIndex(generic, index);
+            break;
+        default: break;
+    }
+}
+static real genericGet(void *list, natural index)
+{
+    real *data = checkListGet((checkList_t*) list, index);
+    return (data != NULL) ? *data : -1;
+}
+
+/*checkTextList_t, generated by LINKED_LIST_DEFINE_WITH: deep copies. Its
+  size is only given while every value alive is in the list, once*/
+static void *textCreate(void)
+{
+    checkTextList_t *list = (checkTextList_t*) malloc(sizeof(checkTextList_t));
+    checkTextListInit(list);
+    return list;
+}
+static void textDestroy(void *list)
+{
+    checkTextListFree((checkTextList_t*) list);
+    free(list);
+
+    if (checkTextLive != 0)
+    {
+        fprintf(stderr, "text: %ld values alive after free\n", checkTextLive);
+        abort();
+    }
+}
+static natural textSize(void *list)
+{
+    natural size = checkTextListSize((checkTextList_t*) list);
+    return (checkTextLive == (long) size) ? size : (natural) -1;
+}
+static void textApply(void *list, checkOperation_t operation, natural index,
+                      real data)
+{
+    checkTextList_t *text = (checkTextList_t*) list;
+    checkText_t value;
+    char buffer[32];
+
+    /*the list keeps copies: the caller's text is overwritten afterwards*/
+    snprintf(buffer, sizeof(buffer), "%.17g", data);
+    value.text = buffer;
+
+    switch(operation)
+    {
+        case CHECK_ADD_BEGIN:    checkTextListAddBegin(text, &value);        break;
+        case CHECK_ADD_END:      checkTextListAddEnd(text, &value);          break;
+        case CHECK_REMOVE_LAST:  checkTextListRemoveLast(text);              break;
+        case CHECK_REMOVE_FIRST: checkTextListRemoveFirst(text);             break;
+        case CHECK_SET:
+            checkTextListSet(text, &value, index);
+            /*setting a value to itself must leave it as it is*/
+            if (index < checkTextListSize(text))
+            {
+                checkTextListSet(text, checkTextListGet(text, index), index);
+            }
+            break;
+        case CHECK_ADD_BY_INDEX:
+            checkTextListAddByIndex(text, &value, index);
+            break;
+        case CHECK_REMOVE_BY_INDEX:
+            checkTextListRemoveByIndex(text, index);
+            break;
+        default: break;
+    }
+    memset(buffer, 0, sizeof(buffer));
+}
+static real textGet(void *list, natural index)
+{
+    checkText_t *value = checkTextListGet((checkTextList_t*) list, index);
+    return (value != NULL) ? strtod(value->text, NULL) : -1;
+}
+
+static const checkVariant_t checkVariants[] =
+{
+    { "linkedList", bareCreate, bareDestroy, bareSize, bareApply, bareGet,
+      bareBatch, 0 },
+    { "handle", handleCreate, handleDestroy, handleSize, handleApply,
+      handleGet, handleBatch, 1 },
+    { "handlePool", handlePoolCreate, handlePoolDestroy, handleSize,
+      handleApply, handleGet, handleBatch, 1 },
+    { "unrolled", unrolledCreate, unrolledDestroy, unrolledSize,
+      unrolledApply, unrolledGet, NULL, 0 },
+    { "skipList", skipCreate, skipDestroy, skipSize, skipApply, skipGet,
+      NULL, 0 },
+    { "doubly", doublyCreate, doublyDestroy, doublySize, doublyApply,
+      doublyGet, NULL, 0 },
+    { "xor", xorCreate, xorDestroy, xorSize, xorApply, xorGet, NULL, 0 },
+    { "generic", genericCreate, genericDestroy, genericSize, genericApply,
+      genericGet, NULL, 0 },
+    { "genericText", textCreate, textDestroy, textSize, textApply, textGet,
+      NULL, 0 },
+};
+
+#define CHECK_VARIANTS (sizeof(checkVariants) / sizeof(checkVariants[0]))
+
+/******************************************************************************
+ * DIFFERENTIAL RUN                                                           *
+ ******************************************************************************/
+
+/*Where the first difference was found*/
+typedef struct checkFailure
+{
+    const char *variant;
+    const char *operation;
+    natural     step;
+    natural     index;
+    real        expected;
+    real        found;
+
+} checkFailure_t;
+
+static int checkFail(checkFailure_t *failure, const char *variant,
+                     checkOperation_t operation, natural step, natural index,
+                     real expected, real found)
+{
+    failure->variant   = variant;
+    failure->operation = checkOperationNames[operation];
+    failure->step      = step;
+    failure->index     = index;
+    failure->expected  = expected;
+    failure->found     = found;
+
+    return 0;
+}
+
+/*Compares the whole contents of a variant with the model*/
+static int checkContents(const checkVariant_t *variant, void *list,
+                         const checkModel_t *model, natural step,
+                         checkFailure_t *failure)
+{
+    register natural i;
+
+    for(i = 0; i < model->size; i++)
+    {
+        real found = variant->get(list, i);
+        if (found != model->values[i])
+        {
+            return checkFail(failure, variant->name, CHECK_CONTENTS, step, i,
+                             model->values[i], found);
+        }
+    }
+
+    return 1;
+}
+
+/*Runs the operations coded by bytes on every variant, and returns 1 if they
+  all matched the model, 0 otherwise (with the failure filled in)*/
+static int checkRun(const uint8_t *bytes, size_t size, checkFailure_t *failure)
+{
+    void *lists[CHECK_VARIANTS];
+    checkModel_t model;
+    linkedListEdit_t edits[CHECK_MAX_EDITS];
+    checkSingle_t singles[CHECK_MAX_EDITS];
+    natural steps = (natural) (size / CHECK_OPERATION_BYTES), step;
+    natural count = 0, single = 0, plainIndex, at;
+    checkOperation_t plain;
+    int passed = 1;
+    register natural v, e;
+
+    model.size = 0;
+    for(v = 0; v < CHECK_VARIANTS; v++) lists[v] = checkVariants[v].create();
+
+    for(step = 0; step < steps && passed; step++)
+    {
+        const uint8_t *code = &bytes[step * CHECK_OPERATION_BYTES];
+        checkOperation_t operation =
+            (checkOperation_t) (code[0] % CHECK_OPERATIONS);
+        /*up to two past the end, so the edges are often reached*/
+        natural index = code[1] % (model.size + 3);
+        real data = (real) (int8_t) code[2];
+
+        if ((operation <= CHECK_ADD_BY_INDEX ||
+             operation == CHECK_CURSOR_INSERT) && model.size == CHECK_MAX_SIZE)
+        {
+            continue;
+        }
+
+        /*what the lists without a cursor do*/
+        plain      = operation;
+        plainIndex = index;
+        if (operation >= CHECK_CURSOR_INSERT && operation <= CHECK_CURSOR_SET)
+        {
+            plain = checkModelCursor(operation, &plainIndex, model.size);
+        }
+
+        if (operation == CHECK_APPLY)
+        {
+            /*the edits are the next operations, and one in four takes the
+              index of the edit before it*/
+            count = 1 + code[1] % CHECK_MAX_EDITS;
+            if (count > steps - step - 1) count = steps - step - 1;
+            if (count == 0 || model.size + count > CHECK_MAX_SIZE) continue;
+
+            for(e = 0; e < count; e++)
+            {
+                code = &bytes[(step + 1 + e) * CHECK_OPERATION_BYTES];
+                edits[e].op    = (linkedListEditOp_t) (code[0] % 3);
+                edits[e].index = (e > 0 && code[1] % 4 == 0) ?
+                                 edits[e - 1].index :
+                                 code[1] % (model.size + 3);
+                edits[e].data  = (real) (int8_t) code[2];
+            }
+            index  = count;
+            single = checkModelBatch(edits, count, model.size, singles);
+            for(e = 0; e < single; e++)
+            {
+                checkModelApply(&model, singles[e].operation,
+                                singles[e].index, singles[e].data);
+            }
+        }
+        else checkModelApply(&model, plain, plainIndex, data);
+
+        for(v = 0; v < CHECK_VARIANTS && passed; v++)
+        {
+            const checkVariant_t *variant = &checkVariants[v];
+            natural found;
+
+            if (operation == CHECK_GET)
+            {
+                real value = variant->get(lists[v], index);
+                if (value != checkModelGet(&model, index))
+                {
+                    passed = checkFail(failure, variant->name, operation,
+                                       step, index,
+                                       checkModelGet(&model, index), value);
+                }
+                continue;
+            }
+            if (operation == CHECK_CONTENTS)
+            {
+                passed = checkContents(variant, lists[v], &model, step,
+                                       failure);
+                continue;
+            }
+
+            if (operation == CHECK_APPLY && variant->batch != NULL)
+            {
+                variant->batch(lists[v], edits, count);
+            }
+            else if (operation == CHECK_APPLY)
+            {
+                for(e = 0; e < single; e++)
+                {
+                    variant->apply(lists[v], singles[e].operation,
+                                   singles[e].index, singles[e].data);
+                }
+            }
+            else if (variant->cursors || plain == operation)
+            {
+                variant->apply(lists[v], operation, index, data);
+            }
+            else variant->apply(lists[v], plain, plainIndex, data);
+
+            found = variant->size(lists[v]);
+            if (found != model.size)
+            {
+                passed = checkFail(failure, variant->name, operation, step,
+                                   index, model.size, found);
+            }
+            else if (operation == CHECK_APPLY)
+            {
+                passed = checkContents(variant, lists[v], &model, step,
+                                       failure);
+            }
+            else if (plain != operation)
+            {
+                /*the next index first: it is the one the handle cached*/
+                for(at = index + 2; at-- > index && passed;)
+                {
+                    real value = variant->get(lists[v], at);
+                    if (value != checkModelGet(&model, at))
+                    {
+                        passed = checkFail(failure, variant->name, operation,
+                                           step, at, checkModelGet(&model, at),
+                                           value);
+                    }
+                }
+            }
+        }
+
+        if (operation == CHECK_APPLY) step += count;
+    }
+
+    for(v = 0; v < CHECK_VARIANTS && passed; v++)
+    {
+        passed = checkContents(&checkVariants[v], lists[v], &model, steps,
+                               failure);
+    }
+    for(v = 0; v < CHECK_VARIANTS; v++) checkVariants[v].destroy(lists[v]);
+
+    return passed;
+}
+
+static void checkReport(const checkFailure_t *failure)
+{
+    fprintf(stderr, "ERROR::%s differs from the model at operation %d (%s, "
+            "index %d): expected %g, found %g\n", failure->variant,
+            failure->step, failure->operation, failure->index,
+            failure->expected, failure->found);
+}
+
+#ifdef LINKEDLIST_FUZZ
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    (void) argc;
+    (void) argv;
+
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+
+    return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *bytes, size_t size)
+{
+    checkFailure_t failure;
+
+    if (!checkRun(bytes, size, &failure))
+    {
+        checkReport(&failure);
+        abort();
+    }
+
+    return 0;
+}
+
+#else
+
+static int checkReplay(const char *path)
+{
+    checkFailure_t failure = { NULL, NULL, 0, 0, 0, 0 };
+    uint8_t *bytes;
+    long size;
+    int passed;
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL || fseek(file, 0, SEEK_END) != 0 ||
+        (size = ftell(file)) < 0)
+    {
+        fprintf(stderr, "ERROR::could not read %s\n", path);
+        if (file != NULL) fclose(file);
+        return 0;
+    }
+    rewind(file);
+
+    bytes = (uint8_t*) malloc((size_t) size + 1);
+    passed = fread(bytes, 1, (size_t) size, file) == (size_t) size;
+    fclose(file);
+
+    if (passed) passed = checkRun(bytes, (size_t) size, &failure);
+    else        fprintf(stderr, "ERROR::could not read %s\n", path);
+
+    if (!passed && failure.variant != NULL)
+    {
+        fprintf(stderr, "%s: ", path);
+        checkReport(&failure);
+    }
+    free(bytes);
+
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long long seed = 1;
+    natural runs = 200, operations = 2000, run;
+    checkFailure_t failure = { NULL, NULL, 0, 0, 0, 0 };
+    register natural i;
+    register int a;
+
+    /*the lists report their edge cases on stdout*/
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+
+    if (argc > 1 && strcmp(argv[1], "--replay") == 0)
+    {
+        int passed = 1;
+        for(a = 2; a < argc; a++) passed &= checkReplay(argv[a]);
+        return passed ? 0 : 1;
+    }
+    if (argc > 1) seed       = strtoull(argv[1], NULL, 10);
+    if (argc > 2) runs       = (natural) strtoul(argv[2], NULL, 10);
+    if (argc > 3) operations = (natural) strtoul(argv[3], NULL, 10);
+
+    size_t size = (size_t) operations * CHECK_OPERATION_BYTES;
+    uint8_t *bytes = (uint8_t*) malloc(size);
+    unsigned long long state = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    for(run = 0; run < runs; run++)
+    {
+        /*xorshift64: the same seed gives the same runs*/
+        for(i = 0; i < size; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            bytes[i] = (uint8_t) (state >> 32);
+        }
+
+        /*one run in four adds twice as often, up to CHECK_MAX_SIZE nodes*/
+        if (run % 4 == 3)
+        {
+            for(i = 0; i < size; i += 2 * CHECK_OPERATION_BYTES)
+            {
+                bytes[i] %= CHECK_ADD_BY_INDEX + 1;
+            }
+        }
+
+        /*every other run is short, and stays near the empty list*/
+        if (!checkRun(bytes, (run % 2 == 0) ? size / 16 : size, &failure))
+        {
+            fprintf(stderr, "seed %llu run %d: ", seed, run);
+            checkReport(&failure);
+            free(bytes);
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "linkedListCheck::[ seed %llu runs %d operations %d "
+            "variants %d ]\n", seed, runs, operations, (int) CHECK_VARIANTS);
+    free(bytes);
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,523 @@
+/******************************************************************************
+ *                        PERSISTENT LINKED LIST FILES                        *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListFile.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LINKED_LIST_FILE_BYTE_ORDER 0x01020304u
+
+static linkedListFileHeader_t *linkedListFileHeader(const linkedListFile_t *file)
+{
+    return (linkedListFileHeader_t*) file->base;
+}
+
+static linkedListFileBlock_t *linkedListFileBlockAt(const linkedListFile_t *file,
+                                                    uint64_t offset)
+{
+    return (linkedListFileBlock_t*) (file->base + offset);
+}
+
+static size_t linkedListFileBlockBytes(natural capacity)
+{
+    return sizeof(linkedListFileBlock_t) + capacity * sizeof(real);
+}
+
+static void linkedListFileHeaderInit(linkedListFileHeader_t *header)
+{
+    memset(header, 0, sizeof(linkedListFileHeader_t));
+    memcpy(header->magic, LINKED_LIST_FILE_MAGIC, sizeof(header->magic));
+    header->version   = LINKED_LIST_FILE_VERSION;
+    header->byteOrder = LINKED_LIST_FILE_BYTE_ORDER;
+    header->end       = sizeof(linkedListFileHeader_t);
+}
+
+/*Follows the chain of blocks of a mapped file, which must stay within the
+  bytes in use, without loops, and hold the number of values of the header.
+  Every later walk relies on it, so a damaged file is refused when opened*/
+static int linkedListFileChainValid(const linkedListFile_t *file)
+{
+    const linkedListFileHeader_t *header = linkedListFileHeader(file);
+    const linkedListFileBlock_t *block;
+    uint64_t offset = header->first, last = 0, count = 0, blocks = 0, limit;
+
+    if (header->end < sizeof(linkedListFileHeader_t)) return 0;
+
+    /*a block takes at least its own header, so a longer chain has a loop*/
+    limit = (header->end - sizeof(linkedListFileHeader_t)) /
+            sizeof(linkedListFileBlock_t);
+
+    while(offset != 0)
+    {
+        if (offset < sizeof(linkedListFileHeader_t) ||
+            offset % sizeof(uint64_t) != 0 || offset > header->end ||
+            header->end - offset < sizeof(linkedListFileBlock_t) ||
+            ++blocks > limit)
+        {
+            return 0;
+        }
+
+        block = linkedListFileBlockAt(file, offset);
+        if (block->count > block->capacity ||
+            (header->end - offset - sizeof(linkedListFileBlock_t)) /
+            sizeof(real) < block->capacity)
+        {
+            return 0;
+        }
+
+        count += block->count;
+        last   = offset;
+        offset = block->next;
+    }
+
+    return count == header->count && last == header->last;
+}
+
+/*Maps the file again, with at least length bytes*/
+static int linkedListFileReserve(linkedListFile_t *file, size_t length)
+{
+    void *base;
+
+    if (length <= file->length) return 1;
+
+    /*growing geometrically, so appending is amortized O(1)*/
+    if (length < 2 * file->length) length = 2 * file->length;
+
+    if (ftruncate(file->fd, (off_t) length) != 0)
+    {
+        printf("ERROR::could not grow the list file\n");
+        return 0;
+    }
+
+    base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+    if (base == MAP_FAILED)
+    {
+        printf("ERROR::could not map the list file\n");
+        return 0;
+    }
+
+    munmap(file->base, file->length);
+    file->base   = (unsigned char*) base;
+    file->length = length;
+
+    return 1;
+}
+
+/******************************************************************************
+ * linkedListFileSave                                                         *
+ ******************************************************************************
+ * description: writes a list into a file, as blocks of contiguous values.    *
+ *              An existing file is replaced.                                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      const char    *path  : file name.                                     *
+ *      linkedList_t  *list  : receives the list address (e.g, &list).        *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                  : 1 if the file was written, 0 otherwise.        *
+ ******************************************************************************/
+int linkedListFileSave(const char *path, const linkedList_t *list)
+{
+    real buffer[LINKED_LIST_FILE_BLOCK];
+    linkedListFileHeader_t header;
+    linkedListFileBlock_t block;
+    const linkedList_t *current = list;
+    uint64_t offset = sizeof(linkedListFileHeader_t);
+    natural count;
+    int written = 1;
+
+    FILE *stream = fopen(path, "wb");
+    if (stream == NULL)
+    {
+        printf("ERROR::could not create %s\n", path);
+        return 0;
+    }
+
+    linkedListFileHeaderInit(&header);
+    written &= fwrite(&header, sizeof(header), 1, stream) == 1;
+
+    while(current != NULL && written)
+    {
+        /*gathering the values of the next block*/
+        for(count = 0; count < LINKED_LIST_FILE_BLOCK && current != NULL; count++)
+        {
+            buffer[count] = current->data;
+            current = current->next;
+        }
+
+        /*the last block is written without free room*/
+        block.count    = count;
+        block.capacity = count;
+        block.next     = current == NULL ? 0 :
+                         offset + linkedListFileBlockBytes(count);
+
+        written &= fwrite(&block, sizeof(block), 1, stream) == 1;
+        written &= fwrite(buffer, sizeof(real), count, stream) == count;
+
+        if (header.first == 0) header.first = offset;
+        header.last   = offset;
+        header.count += count;
+        offset += linkedListFileBlockBytes(count);
+    }
+    header.end = offset;
+
+    /*the header is rewritten with the final counts*/
+    written &= fseek(stream, 0, SEEK_SET) == 0;
+    written &= fwrite(&header, sizeof(header), 1, stream) == 1;
+    written &= fclose(stream) == 0;
+
+    if (!written) printf("ERROR::could not write %s\n", path);
+
+    return written;
+}
+
+/******************************************************************************
+ * linkedListFileOpen                                                         *
+ ******************************************************************************
+ * description: maps a list file into memory. A writable file is created,    *
+ *              empty, if it does not exist. A file whose blocks leave the    *
+ *              bytes in use, overflow, loop or miscount is refused, and so   *
+ *              is one holding more values than a natural can count.          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file     : receives the file address (&file).       *
+ *      const char       *path     : file name.                               *
+ *      int               writable : 1 to allow appending, 0 otherwise.       *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                        : 1 if the file was mapped, 0 otherwise.   *
+ ******************************************************************************/
+int linkedListFileOpen(linkedListFile_t *file, const char *path, int writable)
+{
+    linkedListFileHeader_t *header;
+    struct stat status;
+    void *base;
+    int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+
+    file->base     = NULL;
+    file->length   = 0;
+    file->writable = writable;
+    file->fd       = writable ? open(path, O_RDWR | O_CREAT, 0644) :
+                                open(path, O_RDONLY);
+    if (file->fd < 0)
+    {
+        printf("ERROR::could not open %s\n", path);
+        return 0;
+    }
+
+    if (fstat(file->fd, &status) != 0) status.st_size = 0;
+
+    /*a new file starts with the header of an empty list*/
+    if (status.st_size == 0 && writable)
+    {
+        linkedListFileHeader_t empty;
+        linkedListFileHeaderInit(&empty);
+        if (write(file->fd, &empty, sizeof(empty)) == (ssize_t) sizeof(empty))
+        {
+            status.st_size = sizeof(empty);
+        }
+    }
+
+    if ((size_t) status.st_size < sizeof(linkedListFileHeader_t))
+    {
+        printf("ERROR::%s is not a list file\n", path);
+        close(file->fd);
+        return 0;
+    }
+
+    base = mmap(NULL, (size_t) status.st_size, protection, MAP_SHARED,
+                file->fd, 0);
+    if (base == MAP_FAILED)
+    {
+        printf("ERROR::could not map %s\n", path);
+        close(file->fd);
+        return 0;
+    }
+    file->base   = (unsigned char*) base;
+    file->length = (size_t) status.st_size;
+
+    header = linkedListFileHeader(file);
+    if (memcmp(header->magic, LINKED_LIST_FILE_MAGIC, sizeof(header->magic)) ||
+        header->version != LINKED_LIST_FILE_VERSION ||
+        header->byteOrder != LINKED_LIST_FILE_BYTE_ORDER ||
+        header->end > file->length)
+    {
+        printf("ERROR::%s is not a list file for this machine\n", path);
+        munmap(file->base, file->length);
+        close(file->fd);
+        file->base = NULL;
+        return 0;
+    }
+
+    /*the sizes and indexes of the API are natural*/
+    if (header->count > (natural) -1)
+    {
+        printf("ERROR::%s holds more values than a list can index\n", path);
+        munmap(file->base, file->length);
+        close(file->fd);
+        file->base = NULL;
+        return 0;
+    }
+
+    if (!linkedListFileChainValid(file))
+    {
+        printf("ERROR::%s has a damaged chain of blocks\n", path);
+        munmap(file->base, file->length);
+        close(file->fd);
+        file->base = NULL;
+        return 0;
+    }
+
+    return 1;
+}
+
+/******************************************************************************
+ * linkedListFileClose                                                        *
+ ******************************************************************************
+ * description: unmaps a list file. A writable file is flushed and trimmed to *
+ *              the bytes in use.                                             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file : receives the file address (&file).           *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                   : a closed file.                               *
+ ******************************************************************************/
+void linkedListFileClose(linkedListFile_t *file)
+{
+    uint64_t end;
+
+    if (file->base == NULL) return ;
+
+    end = linkedListFileHeader(file)->end;
+    if (file->writable) msync(file->base, file->length, MS_SYNC);
+    munmap(file->base, file->length);
+
+    if (file->writable && end < file->length)
+    {
+        if (ftruncate(file->fd, (off_t) end) != 0)
+        {
+            printf("ERROR::could not trim the list file\n");
+        }
+    }
+    close(file->fd);
+
+    file->fd     = -1;
+    file->base   = NULL;
+    file->length = 0;
+}
+
+/******************************************************************************
+ * linkedListFileSize                                                         *
+ ******************************************************************************
+ * description: returns the number of values in a list file.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file : receives the file address (&file).           *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural                : number of values in the file.                *
+ ******************************************************************************/
+natural linkedListFileSize(const linkedListFile_t *file)
+{
+    return (natural) linkedListFileHeader(file)->count;
+}
+
+/******************************************************************************
+ * linkedListFileGet                                                          *
+ ******************************************************************************
+ * description: gets a value straight from the mapped pages, skipping whole   *
+ *              blocks until the desired position.                            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file  : receives the file address (&file).          *
+ *      natural           index : desired position in the list.              *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                    : value at the desired position (-1 and an    *
+ *                                error message if there is no such value).   *
+ ******************************************************************************/
+real linkedListFileGet(const linkedListFile_t *file, natural index)
+{
+    const linkedListFileHeader_t *header = linkedListFileHeader(file);
+    const linkedListFileBlock_t *block;
+
+    if (index >= header->count)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    block = linkedListFileBlockAt(file, header->first);
+    while(index >= block->count)
+    {
+        index -= block->count;
+        block  = linkedListFileBlockAt(file, block->next);
+    }
+
+    return block->data[index];
+}
+
+/******************************************************************************
+ * linkedListFileTransverse                                                   *
+ ******************************************************************************
+ * description: prints a list file on the terminal screen, as it is done by   *
+ *              linkedListTransverse.                                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file : receives the file address (&file).           *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                   : printed list on the terminal screen.         *
+ ******************************************************************************/
+void linkedListFileTransverse(const linkedListFile_t *file)
+{
+    uint64_t offset = linkedListFileHeader(file)->first;
+    register natural i;
+
+    printf("linkedList::[");
+    while(offset != 0)
+    {
+        const linkedListFileBlock_t *block = linkedListFileBlockAt(file, offset);
+        for(i = 0; i < block->count; i++)
+        {
+            printf(" %1.1f", block->data[i]);
+        }
+        offset = block->next;
+    }
+    printf(" ]\n");
+}
+
+/******************************************************************************
+ * linkedListFileAppend                                                       *
+ ******************************************************************************
+ * description: adds a value at the end of a writable list file.             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file : receives the file address (&file).           *
+ *      real              data : a double data value.                         *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                    : 1 if the value was added, 0 otherwise.       *
+ ******************************************************************************/
+int linkedListFileAppend(linkedListFile_t *file, real data)
+{
+    return linkedListFileAppendArray(file, &data, 1);
+}
+
+/******************************************************************************
+ * linkedListFileAppendArray                                                  *
+ ******************************************************************************
+ * description: adds the values of an array at the end of a writable list    *
+ *              file. The free room of the last block is filled first, then   *
+ *              new blocks are linked after it.                               *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t *file  : receives the file address (&file).          *
+ *      real             *array : contiguous values.                          *
+ *      natural           size  : number of values in the array.              *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                     : 1 if the values were added, 0 otherwise.    *
+ ******************************************************************************/
+int linkedListFileAppendArray(linkedListFile_t *file, const real *array,
+                              natural size)
+{
+    linkedListFileHeader_t *header;
+    linkedListFileBlock_t *block;
+    uint64_t offset;
+    natural count;
+
+    if (!file->writable)
+    {
+        printf("ERROR::list file is read-only\n");
+        return 0;
+    }
+
+    if (linkedListFileHeader(file)->count + size > (natural) -1)
+    {
+        printf("ERROR::list file cannot index more values\n");
+        return 0;
+    }
+
+    while(size > 0)
+    {
+        header = linkedListFileHeader(file);
+
+        /*a new block is needed when the last one is full*/
+        block = header->last == 0 ? NULL :
+                linkedListFileBlockAt(file, header->last);
+        if (block == NULL || block->count == block->capacity)
+        {
+            offset = header->end;
+            if (!linkedListFileReserve(file, offset +
+                    linkedListFileBlockBytes(LINKED_LIST_FILE_BLOCK)))
+            {
+                return 0;
+            }
+
+            /*the mapping may have moved*/
+            header = linkedListFileHeader(file);
+            block  = linkedListFileBlockAt(file, offset);
+            block->next     = 0;
+            block->count    = 0;
+            block->capacity = LINKED_LIST_FILE_BLOCK;
+
+            if (header->last == 0) header->first = offset;
+            else linkedListFileBlockAt(file, header->last)->next = offset;
+
+            header->last = offset;
+            header->end  = offset + linkedListFileBlockBytes(LINKED_LIST_FILE_BLOCK);
+        }
+
+        /*the values are written before they are counted*/
+        count = block->capacity - block->count;
+        if (count > size) count = size;
+        memcpy(block->data + block->count, array, count * sizeof(real));
+        block->count  += count;
+        header->count += count;
+
+        array += count;
+        size  -= count;
+    }
+
+    return 1;
+}
+
+/******************************************************************************
+ * linkedListFileLoad                                                         *
+ ******************************************************************************
+ * description: appends the values of a list file to the list of a handle,   *
+ *              one block at a time (see linkedListHandleAppendArray).        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListFile_t   *file   : receives the file address (&file).       *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the values at the end of the list.       *
+ ******************************************************************************/
+void linkedListFileLoad(const linkedListFile_t *file,
+                        linkedListHandle_t *handle)
+{
+    uint64_t offset = linkedListFileHeader(file)->first;
+
+    while(offset != 0)
+    {
+        const linkedListFileBlock_t *block = linkedListFileBlockAt(file, offset);
+        linkedListHandleAppendArray(handle, block->data, block->count);
+        offset = block->next;
+    }
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                        PERSISTENT LINKED LIST FILES                        *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * This is an on-disk format for lists, which is read back through mmap. The  *
+ * file starts with a header, holding the number of values, followed by       *
+ * blocks of contiguous real values. The blocks are linked by their offset in *
+ * the file instead of pointers, so the mapped pages are used as they are:    *
+ * getting and printing values need no copy, nor rebuilding the list.         *
+ *                                                                            *
+ * A file opened as writable can also be appended to. The free room of the    *
+ * last block is filled first, then new blocks are added at the end of the    *
+ * file, which grows geometrically and is trimmed when it is closed.          *
+ *                                                                            *
+ * The values are stored in the byte order of the machine which wrote them,   *
+ * and opening a file written with another byte order fails.                  *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_FILE_H__
+#define __LINKED_LIST_FILE_H__
+
+#include "linkedList.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LINKED_LIST_FILE_MAGIC   "LLSTFILE"
+#define LINKED_LIST_FILE_VERSION 1
+#define LINKED_LIST_FILE_BLOCK   1024   /*values per block*/
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct linkedListFileHeader
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t byteOrder;   /*0x01020304 as written by the machine*/
+    uint64_t count;       /*values in the list*/
+    uint64_t first;       /*offset of the first block (0 if none)*/
+    uint64_t last;        /*offset of the last block (0 if none)*/
+    uint64_t end;         /*bytes in use*/
+
+} linkedListFileHeader_t;
+
+typedef struct linkedListFileBlock
+{
+    uint64_t next;        /*offset of the next block (0 if none)*/
+    uint32_t count;
+    uint32_t capacity;
+    real     data[];
+
+} linkedListFileBlock_t;
+
+typedef struct linkedListFile
+{
+    int            fd;
+    unsigned char *base;      /*mapped file*/
+    size_t         length;    /*bytes mapped*/
+    int            writable;
+
+} linkedListFile_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+int linkedListFileSave(const char *path, const linkedList_t *list);
+int linkedListFileOpen(linkedListFile_t *file, const char *path, int writable);
+void linkedListFileClose(linkedListFile_t *file);
+natural linkedListFileSize(const linkedListFile_t *file);
+real linkedListFileGet(const linkedListFile_t *file, natural index);
+void linkedListFileTransverse(const linkedListFile_t *file);
+int linkedListFileAppend(linkedListFile_t *file, real data);
+int linkedListFileAppendArray(linkedListFile_t *file, const real *array,
+                              natural size);
+void linkedListFileLoad(const linkedListFile_t *file,
+                        linkedListHandle_t *handle);
+
+#endif
+/*****END*****/
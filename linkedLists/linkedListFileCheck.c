@@ -0,0 +1,225 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                        LINKED LIST FILES CHECK                             *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListFileCheck [path]                                          *
+ *                                                                            *
+ * Round trip: a list is saved, opened, appended to across the end of its     *
+ * last block, closed (and trimmed), opened again and loaded into a handle,   *
+ * and every value must come back in order.                                   *
+ *                                                                            *
+ * Damaged files: a saved file is corrupted in one place at a time (a block   *
+ * linked into the header, past the end or back to the first one, a count    *
+ * above the capacity, a wrong total, a total beyond what a natural counts)   *
+ * and opening it must fail.                                                  *
+ *                                                                            *
+ * The exit code is 1 on the first failure, which is written to stderr. The   *
+ * error messages of the lists go to stdout, which is sent to /dev/null. The  *
+ * file (linkedListFileCheck.llst by default) is removed at the end.          *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "linkedListFile.h"
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*Values saved, then appended: neither is a multiple of the block size*/
+#define FILE_CHECK_SAVED    2500
+#define FILE_CHECK_APPENDED 1500
+
+static real fileCheckValue(natural index)
+{
+    return (real) index * 0.5 - 100.0;
+}
+
+static int fileCheckFail(const char *message)
+{
+    fprintf(stderr, "linkedListFileCheck::%s\n", message);
+    return 0;
+}
+
+/*Saves the first size values of fileCheckValue*/
+static int fileCheckSave(const char *path, natural size)
+{
+    real *array = (real*) malloc(size * sizeof(real));
+    linkedList_t *list;
+    int saved;
+    register natural i;
+
+    if (array == NULL) return 0;
+    for(i = 0; i < size; i++) array[i] = fileCheckValue(i);
+
+    list  = linkedListFromArray(array, size);
+    saved = linkedListFileSave(path, list);
+    linkedListFree(list);
+    free(array);
+
+    return saved;
+}
+
+static int fileCheckRoundTrip(const char *path)
+{
+    real appended[FILE_CHECK_APPENDED];
+    natural total = FILE_CHECK_SAVED + FILE_CHECK_APPENDED + 1;
+    linkedListFile_t file;
+    linkedListHandle_t handle;
+    int passed = 1;
+    register natural i;
+
+    if (!fileCheckSave(path, FILE_CHECK_SAVED))
+    {
+        return fileCheckFail("round trip: could not save");
+    }
+
+    if (!linkedListFileOpen(&file, path, 0))
+    {
+        return fileCheckFail("round trip: could not open the saved file");
+    }
+    passed &= linkedListFileSize(&file) == FILE_CHECK_SAVED;
+    for(i = 0; i < FILE_CHECK_SAVED; i++)
+    {
+        passed &= linkedListFileGet(&file, i) == fileCheckValue(i);
+    }
+    linkedListFileClose(&file);
+    if (!passed) return fileCheckFail("round trip: saved values differ");
+
+    for(i = 0; i < FILE_CHECK_APPENDED; i++)
+    {
+        appended[i] = fileCheckValue(FILE_CHECK_SAVED + i);
+    }
+    if (!linkedListFileOpen(&file, path, 1))
+    {
+        return fileCheckFail("round trip: could not open for appending");
+    }
+    passed &= linkedListFileAppendArray(&file, appended, FILE_CHECK_APPENDED);
+    passed &= linkedListFileAppend(&file, fileCheckValue(total - 1));
+    linkedListFileClose(&file);
+    if (!passed) return fileCheckFail("round trip: could not append");
+
+    /*the closed file is trimmed, and must still be valid*/
+    if (!linkedListFileOpen(&file, path, 0))
+    {
+        return fileCheckFail("round trip: could not open the appended file");
+    }
+    linkedListHandleInit(&handle);
+    linkedListFileLoad(&file, &handle);
+    passed &= linkedListFileSize(&file) == total;
+    passed &= linkedListHandleSize(&handle) == total;
+    for(i = 0; i < total && passed; i++)
+    {
+        passed &= linkedListHandleGet(&handle, i) == fileCheckValue(i);
+        passed &= linkedListFileGet(&file, i) == fileCheckValue(i);
+    }
+    linkedListHandleFree(&handle);
+    linkedListFileClose(&file);
+
+    return passed ? 1 : fileCheckFail("round trip: loaded values differ");
+}
+
+/*Saves a fresh file and overwrites a field of it in place*/
+static int fileCheckCorrupt(const char *path, off_t offset, uint64_t value,
+                            size_t bytes)
+{
+    int fd, written;
+
+    if (!fileCheckSave(path, FILE_CHECK_SAVED)) return 0;
+
+    fd = open(path, O_RDWR);
+    if (fd < 0) return 0;
+
+    /*the fields are written in the byte order of the machine*/
+    if (bytes == sizeof(uint32_t))
+    {
+        uint32_t narrow = (uint32_t) value;
+        written = pwrite(fd, &narrow, bytes, offset) == (ssize_t) bytes;
+    }
+    else written = pwrite(fd, &value, bytes, offset) == (ssize_t) bytes;
+
+    return (close(fd) == 0) && written;
+}
+
+static int fileCheckDamaged(const char *path)
+{
+    /*the saved blocks are full, so the second starts after 1024 values*/
+    const uint64_t first  = sizeof(linkedListFileHeader_t);
+    const uint64_t second = first + sizeof(linkedListFileBlock_t) +
+                            LINKED_LIST_FILE_BLOCK * sizeof(real);
+    const off_t next     = offsetof(linkedListFileBlock_t, next);
+    const off_t count    = offsetof(linkedListFileBlock_t, count);
+    const struct
+    {
+        const char *name;
+        off_t       offset;
+        uint64_t    value;
+        size_t      bytes;
+
+    } damages[] =
+    {
+        { "block inside the header", first + next, 8, sizeof(uint64_t) },
+        { "block past the end", first + next, 1u << 30, sizeof(uint64_t) },
+        { "misaligned block", first + next, second + 4, sizeof(uint64_t) },
+        { "loop", second + next, first, sizeof(uint64_t) },
+        { "count above capacity", first + count, LINKED_LIST_FILE_BLOCK + 1,
+          sizeof(uint32_t) },
+        { "wrong total", offsetof(linkedListFileHeader_t, count),
+          FILE_CHECK_SAVED + 1, sizeof(uint64_t) },
+        { "total beyond natural", offsetof(linkedListFileHeader_t, count),
+          (uint64_t) 1 << 32, sizeof(uint64_t) },
+        { "no first block", offsetof(linkedListFileHeader_t, first), 0,
+          sizeof(uint64_t) },
+        { "wrong last block", offsetof(linkedListFileHeader_t, last), first,
+          sizeof(uint64_t) },
+        { "end inside a block", offsetof(linkedListFileHeader_t, end),
+          second, sizeof(uint64_t) }
+    };
+    linkedListFile_t file;
+    register natural i;
+
+    for(i = 0; i < sizeof(damages) / sizeof(damages[0]); i++)
+    {
+        if (!fileCheckCorrupt(path, damages[i].offset, damages[i].value,
+                              damages[i].bytes))
+        {
+            return fileCheckFail("damaged: could not write the file");
+        }
+
+        if (linkedListFileOpen(&file, path, i % 2))
+        {
+            linkedListFileClose(&file);
+            fprintf(stderr, "linkedListFileCheck::damaged: %s was opened\n",
+                    damages[i].name);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "linkedListFileCheck.llst";
+    int passed;
+
+    /*the lists report their edge cases on stdout*/
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+
+    passed = fileCheckRoundTrip(path) && fileCheckDamaged(path);
+    remove(path);
+
+    if (!passed) return 1;
+
+    fprintf(stderr, "linkedListFileCheck::[ round trip and damaged files "
+            "passed ]\n");
+
+    return 0;
+}
@@ -0,0 +1,353 @@
+/******************************************************************************
+ *                         TYPE-GENERIC LINKED LISTS                          *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * Generates, at compile time, a linked list holding values of any type T,    *
+ * instead of real values:                                                    *
+ *                                                                            *
+ *     LINKED_LIST_DEFINE(intList, int)                                       *
+ *                                                                            *
+ * defines intList_t, intListNode_t and the intList* functions below. The     *
+ * payload lives inside the node, right after the next pointer, so there is   *
+ * no boxing: an int or a float node takes 16 bytes, and a struct node takes  *
+ * 8 bytes more than the struct (plus its alignment padding).                 *
+ *                                                                            *
+ * Values are passed by address, so a large payload is copied once, straight  *
+ * into its node. It can also be built in place (Emplace*), and moved out of  *
+ * the list without a copy of its resources (PopFront). The copy, destroy and *
+ * compare operations are given per type with LINKED_LIST_DEFINE_WITH (they   *
+ * may be macros, each argument is evaluated once by the generated code):     *
+ *                                                                            *
+ *     COPY(dst, src)    : copies *src into *dst (e.g, a deep copy).          *
+ *     DESTROY(value)    : releases what *value owns, before it is freed.     *
+ *     COMPARE(a, b)     : < 0, 0 or > 0, as *a is below, equal or above *b.  *
+ *                                                                            *
+ * LINKED_LIST_DEFINE uses the assignment, nothing, and the < and > operators *
+ * (which fits numbers and pointers). Nodes come from a pool owned by the     *
+ * list (linkedListPool.h).                                                   *
+ *                                                                            *
+ * Generated functions (name being the first macro parameter):                *
+ *                                                                            *
+ *     void     nameInit(name_t *list)                                        *
+ *     void     nameFree(name_t *list)                                        *
+ *     natural  nameSize(const name_t *list)                                  *
+ *     void     nameAddBegin(name_t *list, const T *value)                    *
+ *     void     nameAddEnd(name_t *list, const T *value)                      *
+ *     void     nameAddByIndex(name_t *list, const T *value, natural index)   *
+ *     T       *nameEmplaceBegin(name_t *list)                                *
+ *     T       *nameEmplaceEnd(name_t *list)                                  *
+ *     int      namePopFront(name_t *list, T *value)                          *
+ *     void     nameRemoveLast(name_t *list)                                  *
+ *     void     nameRemoveFirst(name_t *list)                                 *
+ *     void     nameRemoveByIndex(name_t *list, natural index)                *
+ *     void     nameSet(name_t *list, const T *value, natural index)          *
+ *     T       *nameGet(const name_t *list, natural index)                    *
+ *     int      nameFind(const name_t *list, const T *value, natural *index)  *
+ *     void     nameInsertSorted(name_t *list, const T *value)                *
+ *     void     nameForEach(const name_t *list, void (*visit)(T*, void*),     *
+ *                          void *context)                                    *
+ *                                                                            *
+ * They behave as the linkedList.h ones: an index beyond the last position    *
+ * appends, out of range sets and removals are ignored, and Get gives NULL    *
+ * (with an error message) when there is no such value.                       *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_GENERIC_H__
+#define __LINKED_LIST_GENERIC_H__
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*Nodes carved from each chunk of the pool*/
+#define LINKED_LIST_GENERIC_CHUNK 1024
+
+/******************************************************************************
+ * DEFAULT TYPE OPERATIONS                                                    *
+ ******************************************************************************/
+#define LINKED_LIST_COPY_ASSIGN(dst, src)  (*(dst) = *(src))
+#define LINKED_LIST_DESTROY_NONE(value)    ((void) (value))
+#define LINKED_LIST_COMPARE_ORDER(a, b)    ((*(a) > *(b)) - (*(a) < *(b)))
+
+#define LINKED_LIST_DEFINE(name, T)                                           \
+    LINKED_LIST_DEFINE_WITH(name, T, LINKED_LIST_COPY_ASSIGN,                 \
+                            LINKED_LIST_DESTROY_NONE,                         \
+                            LINKED_LIST_COMPARE_ORDER)
+
+/******************************************************************************
+ * LIST GENERATOR                                                             *
+ ******************************************************************************/
+#define LINKED_LIST_DEFINE_WITH(name, T, COPY, DESTROY, COMPARE)              \
+                                                                              \
+typedef struct name##Node                                                     \
+{                                                                             \
+    struct name##Node *next;                                                  \
+    T                  data;                                                  \
+                                                                              \
+} name##Node_t;                                                               \
+                                                                              \
+typedef struct name                                                           \
+{                                                                             \
+    name##Node_t     *head;                                                   \
+    name##Node_t     *tail;                                                   \
+    natural           size;                                                   \
+    linkedListPool_t  pool;                                                   \
+                                                                              \
+} name##_t;                                                                   \
+                                                                              \
+/*Links a node, whose payload is not set yet, after previous (NULL: head)*/   \
+static inline T *name##Link(name##_t *list, name##Node_t *previous)           \
+{                                                                             \
+    name##Node_t *node = (name##Node_t*) linkedListPoolAlloc(&list->pool);    \
+                                                                              \
+    if (previous == NULL)                                                     \
+    {                                                                         \
+        node->next = list->head;                                              \
+        list->head = node;                                                    \
+    }                                                                         \
+    else                                                                      \
+    {                                                                         \
+        node->next     = previous->next;                                      \
+        previous->next = node;                                                \
+    }                                                                         \
+    if (node->next == NULL) list->tail = node;                                \
+    list->size++;                                                             \
+                                                                              \
+    return &node->data;                                                       \
+}                                                                             \
+                                                                              \
+/*Unlinks the node after previous (NULL: head), without destroying it*/       \
+static inline name##Node_t *name##Unlink(name##_t *list,                      \
+                                         name##Node_t *previous)              \
+{                                                                             \
+    name##Node_t *node = (previous == NULL) ? list->head : previous->next;    \
+                                                                              \
+    if (previous == NULL) list->head = node->next;                            \
+    else                  previous->next = node->next;                        \
+    if (list->tail == node) list->tail = previous;                            \
+    list->size--;                                                             \
+                                                                              \
+    return node;                                                              \
+}                                                                             \
+                                                                              \
+/*Node before index (NULL for index 0), with index <= size*/                  \
+static inline name##Node_t *name##Before(const name##_t *list, natural index) \
+{                                                                             \
+    name##Node_t *previous = NULL;                                            \
+    register natural i;                                                       \
+                                                                              \
+    if (index == 0) return NULL;                                              \
+    if (index == list->size) return list->tail;                               \
+                                                                              \
+    previous = list->head;                                                    \
+    for(i = 1; i < index; i++) previous = previous->next;                     \
+                                                                              \
+    return previous;                                                          \
+}                                                                             \
+                                                                              \
+static inline void name##Init(name##_t *list)                                 \
+{                                                                             \
+    linkedListPoolInitSized(&list->pool, sizeof(name##Node_t),                \
+                            LINKED_LIST_GENERIC_CHUNK);                       \
+    list->head = NULL;                                                        \
+    list->tail = NULL;                                                        \
+    list->size = 0;                                                           \
+}                                                                             \
+                                                                              \
+static inline void name##Free(name##_t *list)                                 \
+{                                                                             \
+    name##Node_t *current = list->head;                                       \
+                                                                              \
+    for(; current != NULL; current = current->next) DESTROY(&current->data);  \
+                                                                              \
+    linkedListPoolDestroy(&list->pool);                                       \
+    name##Init(list);                                                         \
+}                                                                             \
+                                                                              \
+static inline natural name##Size(const name##_t *list)                        \
+{                                                                             \
+    return list->size;                                                        \
+}                                                                             \
+                                                                              \
+static inline T *name##EmplaceBegin(name##_t *list)                           \
+{                                                                             \
+    return name##Link(list, NULL);                                            \
+}                                                                             \
+                                                                              \
+static inline T *name##EmplaceEnd(name##_t *list)                             \
+{                                                                             \
+    return name##Link(list, list->tail);                                      \
+}                                                                             \
+                                                                              \
+static inline void name##AddBegin(name##_t *list, const T *value)             \
+{                                                                             \
+    T *data = name##EmplaceBegin(list);                                       \
+                                                                              \
+    COPY(data, value);                                                        \
+}                                                                             \
+                                                                              \
+static inline void name##AddEnd(name##_t *list, const T *value)               \
+{                                                                             \
+    T *data = name##EmplaceEnd(list);                                         \
+                                                                              \
+    COPY(data, value);                                                        \
+}                                                                             \
+                                                                              \
+static inline void name##AddByIndex(name##_t *list, const T *value,           \
+                                    natural index)                            \
+{                                                                             \
+    T *data;                                                                  \
+                                                                              \
+    if (index > list->size) index = list->size;                               \
+                                                                              \
+    data = name##Link(list, name##Before(list, index));                       \
+    COPY(data, value);                                                        \
+}                                                                             \
+                                                                              \
+/*Moves the first value out of the list: it is not copied nor destroyed*/    \
+static inline int name##PopFront(name##_t *list, T *value)                    \
+{                                                                             \
+    name##Node_t *node;                                                       \
+                                                                              \
+    if (list->size == 0)                                                      \
+    {                                                                         \
+        printf("ERROR::list is empty\n");                                     \
+        return 0;                                                             \
+    }                                                                         \
+                                                                              \
+    node = name##Unlink(list, NULL);                                          \
+    memcpy(value, &node->data, sizeof(T));                                    \
+    linkedListPoolRelease(&list->pool, node);                                 \
+                                                                              \
+    return 1;                                                                 \
+}                                                                             \
+                                                                              \
+static inline void name##RemoveByIndex(name##_t *list, natural index)         \
+{                                                                             \
+    name##Node_t *node;                                                       \
+                                                                              \
+    if (index >= list->size) return ;                                         \
+                                                                              \
+    node = name##Unlink(list, name##Before(list, index));                     \
+    DESTROY(&node->data);                                                     \
+    linkedListPoolRelease(&list->pool, node);                                 \
+}                                                                             \
+                                                                              \
+static inline void name##RemoveFirst(name##_t *list)                          \
+{                                                                             \
+    if (list->size == 0)                                                      \
+    {                                                                         \
+        printf("ERROR::list is empty\n");                                     \
+        return ;                                                              \
+    }                                                                         \
+                                                                              \
+    name##RemoveByIndex(list, 0);                                             \
+}                                                                             \
+                                                                              \
+static inline void name##RemoveLast(name##_t *list)                           \
+{                                                                             \
+    if (list->size == 0)                                                      \
+    {                                                                         \
+        printf("ERROR::list is empty\n");                                     \
+        return ;                                                              \
+    }                                                                         \
+                                                                              \
+    name##RemoveByIndex(list, list->size - 1);                                \
+}                                                                             \
+                                                                              \
+static inline T *name##Get(const name##_t *list, natural index)               \
+{                                                                             \
+    if (index >= list->size)                                                  \
+    {                                                                         \
+        printf("ERROR::There is no data or node for index %d\n", index);      \
+        return NULL;                                                          \
+    }                                                                         \
+                                                                              \
+    if (index == list->size - 1) return &list->tail->data;                    \
+                                                                              \
+    return (index == 0) ? &list->head->data                                   \
+                        : &name##Before(list, index)->next->data;             \
+}                                                                             \
+                                                                              \
+static inline void name##Set(name##_t *list, const T *value, natural index)   \
+{                                                                             \
+    T *data, copy;                                                            \
+                                                                              \
+    if (index >= list->size) return ;                                         \
+                                                                              \
+    /*copied before the old value is destroyed: value may be that very        \
+      slot, or point into something it owns*/                                 \
+    data = name##Get(list, index);                                            \
+    COPY(&copy, value);                                                       \
+    DESTROY(data);                                                            \
+    memcpy(data, &copy, sizeof(T));                                           \
+}                                                                             \
+                                                                              \
+/*Index of the first value equal to *value*/                                  \
+static inline int name##Find(const name##_t *list, const T *value,            \
+                             natural *index)                                  \
+{                                                                             \
+    name##Node_t *current = list->head;                                       \
+    natural at = 0;                                                           \
+                                                                              \
+    for(; current != NULL; current = current->next, at++)                     \
+    {                                                                         \
+        if (COMPARE(&current->data, value) == 0)                              \
+        {                                                                     \
+            *index = at;                                                      \
+            return 1;                                                         \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    return 0;                                                                 \
+}                                                                             \
+                                                                              \
+/*Keeps an ascending list in order, equal values in insertion order*/         \
+static inline void name##InsertSorted(name##_t *list, const T *value)         \
+{                                                                             \
+    name##Node_t *previous = NULL;                                            \
+    name##Node_t *current  = list->head;                                      \
+    T *data;                                                                  \
+                                                                              \
+    /*values not below the last one go straight to the end*/                  \
+    if (list->tail != NULL && COMPARE(&list->tail->data, value) <= 0)         \
+    {                                                                         \
+        previous = list->tail;                                                \
+    }                                                                         \
+    else                                                                      \
+    {                                                                         \
+        while(current != NULL && COMPARE(&current->data, value) <= 0)         \
+        {                                                                     \
+            previous = current;                                               \
+            current  = current->next;                                         \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    data = name##Link(list, previous);                                        \
+    COPY(data, value);                                                        \
+}                                                                             \
+                                                                              \
+static inline void name##ForEach(const name##_t *list,                        \
+                                 void (*visit)(T *value, void *context),      \
+                                 void *context)                               \
+{                                                                             \
+    name##Node_t *current = list->head;                                       \
+                                                                              \
+    for(; current != NULL; current = current->next)                           \
+    {                                                                         \
+        visit(&current->data, context);                                       \
+    }                                                                         \
+}
+
+#endif
+/*****END*****/
@@ -0,0 +1,244 @@
+/******************************************************************************
+ *                      LINKED LIST INSTRUMENTATION                           *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListInstrument.h"
+
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define LINKED_LIST_OPERATION_NAME(id, function) #function,
+static const char *linkedListOperationNames[LINKED_LIST_OP_COUNT] =
+{
+    LINKED_LIST_OPERATIONS(LINKED_LIST_OPERATION_NAME)
+};
+#undef LINKED_LIST_OPERATION_NAME
+
+/*Shared by every thread, and updated with relaxed atomic additions*/
+static linkedListOperationStats_t linkedListCounters[LINKED_LIST_OP_COUNT];
+
+/*The counters are only unsigned long long words*/
+#define COUNTER_WORDS (LINKED_LIST_OP_COUNT * \
+    (sizeof(linkedListOperationStats_t) / sizeof(unsigned long long)))
+
+#ifdef LINKEDLIST_INSTRUMENT
+
+/*Work of the outermost open probe of each thread*/
+__thread unsigned long long linkedListProbeTraversed;
+__thread unsigned long long linkedListProbeAllocations;
+__thread unsigned long long linkedListProbeFrees;
+static __thread natural     linkedListProbeDepth;
+
+#define COUNTER_ADD(counter, value) \
+    __atomic_fetch_add(&(counter), (value), __ATOMIC_RELAXED)
+
+static unsigned long long linkedListProbeClock(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    /*nanoseconds stand for cycles where there is no cycle counter*/
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long) now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+linkedListProbe_t linkedListProbeBegin(linkedListOperation_t operation)
+{
+    linkedListProbe_t probe;
+
+    if (linkedListProbeDepth++ == 0)
+    {
+        linkedListProbeTraversed   = 0;
+        linkedListProbeAllocations = 0;
+        linkedListProbeFrees       = 0;
+    }
+
+    probe.operation = operation;
+    probe.start     = linkedListProbeClock();
+
+    return probe;
+}
+
+void linkedListProbeEnd(linkedListProbe_t *probe)
+{
+    linkedListOperationStats_t *stats = &linkedListCounters[probe->operation];
+    unsigned long long cycles = linkedListProbeClock() - probe->start;
+    natural bucket = 63 - __builtin_clzll(cycles | 1);
+
+    if (bucket >= LINKED_LIST_HISTOGRAM_BUCKETS)
+    {
+        bucket = LINKED_LIST_HISTOGRAM_BUCKETS - 1;
+    }
+
+    COUNTER_ADD(stats->calls, 1);
+    COUNTER_ADD(stats->cycles, cycles);
+    COUNTER_ADD(stats->histogram[bucket], 1);
+
+    /*the outermost probe takes the work of the whole call*/
+    if (--linkedListProbeDepth == 0)
+    {
+        COUNTER_ADD(stats->traversed,   linkedListProbeTraversed);
+        COUNTER_ADD(stats->allocations, linkedListProbeAllocations);
+        COUNTER_ADD(stats->frees,       linkedListProbeFrees);
+    }
+}
+
+#endif
+
+/******************************************************************************
+ * linkedListStatsName                                                        *
+ ******************************************************************************
+ * description: returns the name of the function counted by an operation.     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListOperation_t operation : instrumented operation.             *
+ *                                                                            *
+ * output:                                                                    *
+ *      const char*                     : function name (e.g, "linkedListGet")*
+ ******************************************************************************/
+const char *linkedListStatsName(linkedListOperation_t operation)
+{
+    if (operation >= LINKED_LIST_OP_COUNT) return "unknown";
+
+    return linkedListOperationNames[operation];
+}
+
+/******************************************************************************
+ * linkedListStatsSnapshot                                                    *
+ ******************************************************************************
+ * description: copies the current counters. Counting goes on while the copy  *
+ *              is made, so each counter is exact but they may be a few calls *
+ *              apart from each other.                                        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListStats_t *stats : receives the snapshot address (&stats).    *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : the counters, or zeros if compiled out.    *
+ ******************************************************************************/
+void linkedListStatsSnapshot(linkedListStats_t *stats)
+{
+    const unsigned long long *from = 
+        (const unsigned long long*) linkedListCounters;
+    unsigned long long *to = (unsigned long long*) stats->operations;
+    register size_t i;
+
+#ifdef LINKEDLIST_INSTRUMENT
+    stats->enabled = 1;
+#else
+    stats->enabled = 0;
+#endif
+
+    for(i = 0; i < COUNTER_WORDS; i++)
+    {
+        to[i] = __atomic_load_n(&from[i], __ATOMIC_RELAXED);
+    }
+}
+
+/******************************************************************************
+ * linkedListStatsReset                                                       *
+ ******************************************************************************
+ * description: sets every counter back to zero.                              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      void                                                                  *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : zeroed counters.                           *
+ ******************************************************************************/
+void linkedListStatsReset(void)
+{
+    unsigned long long *counters = (unsigned long long*) linkedListCounters;
+    register size_t i;
+
+    for(i = 0; i < COUNTER_WORDS; i++)
+    {
+        __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+/******************************************************************************
+ * linkedListStatsWrite                                                       *
+ ******************************************************************************
+ * description: writes a snapshot as CSV, one row per operation called at     *
+ *              least once, with the histogram buckets as the last columns.   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListStats_t *stats  : receives the snapshot address (&stats).   *
+ *      FILE              *stream : output stream (e.g, stdout).              *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                       : 1 if the rows were written, 0 otherwise.  *
+ ******************************************************************************/
+int linkedListStatsWrite(const linkedListStats_t *stats, FILE *stream)
+{
+    register natural i, b;
+
+    fprintf(stream, "operation,calls,traversed,allocations,frees,cycles");
+    for(b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++)
+    {
+        fprintf(stream, ",cycles_2^%u", b);
+    }
+    fprintf(stream, "\n");
+
+    for(i = 0; i < LINKED_LIST_OP_COUNT; i++)
+    {
+        const linkedListOperationStats_t *op = &stats->operations[i];
+        if (op->calls == 0) continue;
+
+        fprintf(stream, "%s,%llu,%llu,%llu,%llu,%llu",
+                linkedListOperationNames[i], op->calls, op->traversed,
+                op->allocations, op->frees, op->cycles);
+        for(b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++)
+        {
+            fprintf(stream, ",%llu", op->histogram[b]);
+        }
+        fprintf(stream, "\n");
+    }
+
+    return !ferror(stream);
+}
+
+/******************************************************************************
+ * linkedListStatsExport                                                      *
+ ******************************************************************************
+ * description: takes a snapshot and writes it into a file, as CSV (see       *
+ *              linkedListStatsWrite). An existing file is replaced.          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      const char *path : file name.                                         *
+ *                                                                            *
+ * output:                                                                    *
+ *      int              : 1 if the file was written, 0 otherwise.            *
+ ******************************************************************************/
+int linkedListStatsExport(const char *path)
+{
+    linkedListStats_t stats;
+    int written;
+
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        printf("ERROR::could not create %s\n", path);
+        return 0;
+    }
+
+    linkedListStatsSnapshot(&stats);
+    written  = linkedListStatsWrite(&stats, stream);
+    written &= fclose(stream) == 0;
+
+    if (!written) printf("ERROR::could not write %s\n", path);
+
+    return written;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ *                      LINKED LIST INSTRUMENTATION                           *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * Counters for the functions of linkedList.h which read or change nodes:     *
+ * number of calls, nodes traversed, nodes allocated and released, and a      *
+ * histogram of the cycles spent per call (bucket b counts the calls which    *
+ * took from 2^b up to 2^(b+1) - 1 cycles).                                   *
+ *                                                                            *
+ * A call made from inside another one (e.g., linkedListAddBegin inside       *
+ * linkedListAddByIndex) is counted, and timed, on its own, but the nodes it  *
+ * traverses, allocates or releases are charged to the outermost call.        *
+ *                                                                            *
+ * The counters only exist when linkedList.c is compiled with                 *
+ * LINKEDLIST_INSTRUMENT defined (the CMake option of the same name). Without *
+ * it the probes are empty macros, so there is no cost at all, and a snapshot *
+ * is all zeros with its enabled flag cleared.                                *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_INSTRUMENT_H__
+#define __LINKED_LIST_INSTRUMENT_H__
+
+#include "linkedList.h"
+
+#include <stdio.h>
+
+#define LINKED_LIST_HISTOGRAM_BUCKETS 32
+
+/*Instrumented functions: enumeration suffix and function name*/
+#define LINKED_LIST_OPERATIONS(X)                                             \
+    X(NEW,                    linkedListNew)                                  \
+    X(FREE,                   linkedListFree)                                 \
+    X(ADD_BEGIN,              linkedListAddBegin)                             \
+    X(ADD_END,                linkedListAddEnd)                               \
+    X(ADD_BY_INDEX,           linkedListAddByIndex)                           \
+    X(REMOVE_LAST,            linkedListRemoveLast)                           \
+    X(REMOVE_FIRST,           linkedListRemoveFirst)                          \
+    X(REMOVE_BY_INDEX,        linkedListRemoveByIndex)                        \
+    X(SET,                    linkedListSet)                                  \
+    X(GET,                    linkedListGet)                                  \
+    X(TRANSVERSE,             linkedListTransverse)                           \
+    X(FROM_ARRAY,             linkedListFromArray)                            \
+    X(TO_ARRAY,               linkedListToArray)                              \
+    X(COPY_INTO,              linkedListCopyInto)                             \
+    X(HANDLE_FREE,            linkedListHandleFree)                           \
+    X(HANDLE_PREPEND,         linkedListHandlePrepend)                        \
+    X(HANDLE_APPEND,          linkedListHandleAppend)                         \
+    X(HANDLE_APPEND_ARRAY,    linkedListHandleAppendArray)                    \
+    X(HANDLE_ADD_BY_INDEX,    linkedListHandleAddByIndex)                     \
+    X(HANDLE_POP_FRONT,       linkedListHandlePopFront)                       \
+    X(HANDLE_REMOVE_LAST,     linkedListHandleRemoveLast)                     \
+    X(HANDLE_REMOVE_BY_INDEX, linkedListHandleRemoveByIndex)                  \
+    X(HANDLE_SET,             linkedListHandleSet)                            \
+    X(HANDLE_GET,             linkedListHandleGet)                            \
+    X(HANDLE_TRANSVERSE,      linkedListHandleTransverse)                     \
+    X(CURSOR_NEXT,            linkedListCursorNext)                           \
+    X(CURSOR_SEEK,            linkedListCursorSeek)                           \
+    X(CURSOR_GET,             linkedListCursorGet)                            \
+    X(CURSOR_SET,             linkedListCursorSet)                            \
+    X(CURSOR_INSERT_AFTER,    linkedListCursorInsertAfter)                    \
+    X(CURSOR_ERASE,           linkedListCursorErase)                          \
+    X(APPLY,                  linkedListApply)                                \
+    X(HANDLE_APPLY,           linkedListHandleApply)
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+#define LINKED_LIST_OPERATION_ENUM(id, function) LINKED_LIST_OP_##id,
+typedef enum linkedListOperation
+{
+    LINKED_LIST_OPERATIONS(LINKED_LIST_OPERATION_ENUM)
+    LINKED_LIST_OP_COUNT
+
+} linkedListOperation_t;
+#undef LINKED_LIST_OPERATION_ENUM
+
+typedef struct linkedListOperationStats
+{
+    unsigned long long calls;
+    unsigned long long traversed;     /*nodes walked through*/
+    unsigned long long allocations;   /*nodes allocated*/
+    unsigned long long frees;         /*nodes released*/
+    unsigned long long cycles;        /*total over every call*/
+    unsigned long long histogram[LINKED_LIST_HISTOGRAM_BUCKETS];
+
+} linkedListOperationStats_t;
+
+typedef struct linkedListStats
+{
+    int                        enabled;   /*0 when compiled out*/
+    linkedListOperationStats_t operations[LINKED_LIST_OP_COUNT];
+
+} linkedListStats_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+const char *linkedListStatsName(linkedListOperation_t operation);
+void linkedListStatsSnapshot(linkedListStats_t *stats);
+void linkedListStatsReset(void);
+int linkedListStatsWrite(const linkedListStats_t *stats, FILE *stream);
+int linkedListStatsExport(const char *path);
+
+/******************************************************************************
+ * PROBES                                                                     *
+ ******************************************************************************
+ * Used by linkedList.c: LINKED_LIST_PROBE opens a probe which is closed when *
+ * the function returns, and the other ones charge work to the open probe.    *
+ ******************************************************************************/
+#ifdef LINKEDLIST_INSTRUMENT
+
+typedef struct linkedListProbe
+{
+    linkedListOperation_t operation;
+    unsigned long long    start;
+
+} linkedListProbe_t;
+
+extern __thread unsigned long long linkedListProbeTraversed;
+extern __thread unsigned long long linkedListProbeAllocations;
+extern __thread unsigned long long linkedListProbeFrees;
+
+linkedListProbe_t linkedListProbeBegin(linkedListOperation_t operation);
+void linkedListProbeEnd(linkedListProbe_t *probe);
+
+#define LINKED_LIST_PROBE(id)                                                 \
+    linkedListProbe_t linkedListProbe                                         \
+        __attribute__((cleanup(linkedListProbeEnd))) =                        \
+        linkedListProbeBegin(LINKED_LIST_OP_##id)
+#define LINKED_LIST_PROBE_TRAVERSED(count) (linkedListProbeTraversed += (count))
+#define LINKED_LIST_PROBE_ALLOCATED(count) \
+    (linkedListProbeAllocations += (count))
+#define LINKED_LIST_PROBE_RELEASED(count)  (linkedListProbeFrees += (count))
+
+#else
+
+#define LINKED_LIST_PROBE(id)              ((void) 0)
+#define LINKED_LIST_PROBE_TRAVERSED(count) ((void) 0)
+#define LINKED_LIST_PROBE_ALLOCATED(count) ((void) 0)
+#define LINKED_LIST_PROBE_RELEASED(count)  ((void) 0)
+
+#endif
+
+#endif
+/*****END*****/
@@ -0,0 +1,412 @@
+/******************************************************************************
+ *                      PARALLEL LINKED LIST WALKS                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListParallel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*Segments per worker, so that stealing can even out the slower ones*/
+#define PARALLEL_TASKS_PER_WORKER 8
+
+typedef enum parallelKind
+{
+    PARALLEL_MAP = 0,
+    PARALLEL_FILTER,
+    PARALLEL_FOR_EACH
+
+} parallelKind_t;
+
+typedef struct parallelJob
+{
+    parallelKind_t               kind;
+    linkedListMap_t              map;
+    linkedListPredicate_t        predicate;
+    linkedListVisit_t            visit;
+    void                        *context;
+    /*filter: the nodes kept come from allocator, called under lock*/
+    const linkedListAllocator_t *allocator;
+    pthread_mutex_t             *lock;
+
+} parallelJob_t;
+
+typedef struct parallelSegment
+{
+    const parallelJob_t *job;
+    linkedList_t        *first;
+    natural              start;       /*index of the first node*/
+    natural              count;
+    /*filter: the chain of the values kept, and how many they are*/
+    linkedList_t        *head;
+    linkedList_t        *tail;
+    natural              kept;
+    int                  failed;      /*the allocator ran out of nodes*/
+
+} parallelSegment_t;
+
+/*Links a node holding data at the end of the chain of a segment*/
+static void parallelLink(parallelSegment_t *segment, linkedList_t *node,
+                         real data)
+{
+    node->data = data;
+    node->next = NULL;
+
+    if (segment->tail == NULL) segment->head = node;
+    else                       segment->tail->next = node;
+    segment->tail = node;
+}
+
+/*Adds nodes holding the values to the chain of a segment. The allocator is
+  not assumed to be thread-safe (a pool is not), so it is called under the
+  lock of the job: once when it gives blocks, once per node otherwise.
+  Returns 0 when it runs out of nodes, with the ones it gave linked.*/
+static int parallelChain(parallelSegment_t *segment, const real *values,
+                         natural count)
+{
+    const linkedListAllocator_t *allocator = segment->job->allocator;
+    linkedList_t *nodes = NULL, *node;
+    natural made = 0;
+
+    if (count == 0) return 1;
+
+    pthread_mutex_lock(segment->job->lock);
+    if (allocator->allocBlock != NULL)
+    {
+        nodes = allocator->allocBlock(allocator->context, count);
+    }
+    if (nodes == NULL)
+    {
+        for(; made < count; made++)
+        {
+            node = allocator->alloc(allocator->context);
+            if (node == NULL) break;
+            parallelLink(segment, node, values[made]);
+        }
+    }
+    pthread_mutex_unlock(segment->job->lock);
+
+    /*the nodes of a block are linked outside the lock*/
+    if (nodes != NULL)
+    {
+        for(; made < count; made++)
+        {
+            parallelLink(segment, &nodes[made], values[made]);
+        }
+    }
+    segment->kept += made;
+
+    return made == count;
+}
+
+/*Gives a chain back to the allocator*/
+static void parallelRelease(const linkedListAllocator_t *allocator,
+                            linkedList_t *head, linkedList_t *tail)
+{
+    linkedList_t *next;
+
+    if (head == NULL) return ;
+
+    if (allocator->releaseList != NULL)
+    {
+        allocator->releaseList(allocator->context, head, tail);
+        return ;
+    }
+
+    while(head != NULL)
+    {
+        next = head->next;
+        allocator->release(allocator->context, head);
+        head = next;
+    }
+}
+
+static void parallelSegmentTask(void *argument)
+{
+    parallelSegment_t *segment = (parallelSegment_t*) argument;
+    const parallelJob_t *job = segment->job;
+    linkedList_t *current = segment->first;
+    real values[LINKED_LIST_PARALLEL_STRIDE];
+    natural count;
+    register natural i;
+
+    switch(job->kind)
+    {
+        case PARALLEL_MAP:
+            for(i = 0; i < segment->count && current != NULL; i++)
+            {
+                current->data = job->map(current->data, job->context);
+                current = current->next;
+            }
+            break;
+
+        case PARALLEL_FILTER:
+            /*the values kept are gathered a stride at a time, and then get
+              their nodes at once*/
+            for(i = 0; i < segment->count && current != NULL;)
+            {
+                for(count = 0; count < LINKED_LIST_PARALLEL_STRIDE &&
+                    i < segment->count && current != NULL; i++)
+                {
+                    if (job->predicate(current->data, job->context))
+                    {
+                        values[count++] = current->data;
+                    }
+                    current = current->next;
+                }
+                if (!parallelChain(segment, values, count))
+                {
+                    segment->failed = 1;
+                    break;
+                }
+            }
+            break;
+
+        case PARALLEL_FOR_EACH:
+            for(i = 0; i < segment->count && current != NULL; i++)
+            {
+                job->visit(current->data, segment->start + i, job->context);
+                current = current->next;
+            }
+            break;
+    }
+}
+
+/*The first walk: notes every stride-th node and the size of the list, then
+  groups the notes into at most parts segments of whole strides*/
+static parallelSegment_t *parallelSplit(const parallelJob_t *job,
+                                        linkedList_t *list, natural parts,
+                                        natural *segments, natural *size)
+{
+    linkedList_t **notes, **grown, *current = list;
+    parallelSegment_t *split;
+    natural count = 0, capacity = 64, first, last;
+    register natural i;
+
+    notes = (linkedList_t**) malloc(capacity * sizeof(linkedList_t*));
+    if (notes == NULL) return NULL;
+
+    *size = 0;
+    while(current != NULL)
+    {
+        if (*size % LINKED_LIST_PARALLEL_STRIDE == 0)
+        {
+            if (count == capacity)
+            {
+                grown = (linkedList_t**) realloc(notes, 2 * capacity *
+                                                 sizeof(linkedList_t*));
+                if (grown == NULL)
+                {
+                    free(notes);
+                    return NULL;
+                }
+                notes     = grown;
+                capacity *= 2;
+            }
+            notes[count++] = current;
+        }
+        (*size)++;
+        current = current->next;
+    }
+
+    if (parts > count) parts = count;
+    split = (parallelSegment_t*) malloc(parts * sizeof(parallelSegment_t));
+    if (split == NULL)
+    {
+        free(notes);
+        return NULL;
+    }
+
+    /*the last segment ends with the list, whatever its last stride holds*/
+    for(i = 0; i < parts; i++)
+    {
+        first = (natural) ((unsigned long long) i * count / parts);
+        last  = (natural) ((unsigned long long) (i + 1) * count / parts);
+
+        split[i].job    = job;
+        split[i].first  = notes[first];
+        split[i].start  = first * LINKED_LIST_PARALLEL_STRIDE;
+        split[i].count  = (i == parts - 1) ? *size - split[i].start :
+                          (last - first) * LINKED_LIST_PARALLEL_STRIDE;
+        split[i].head   = NULL;
+        split[i].tail   = NULL;
+        split[i].kept   = 0;
+        split[i].failed = 0;
+    }
+
+    free(notes);
+    *segments = parts;
+
+    return split;
+}
+
+/*Runs a job over the whole list. The chains kept by a filter are spliced,
+  in order, at the end of filtered; if a segment ran out of nodes, they are
+  all given back instead, and 0 is returned.*/
+static int parallelRun(parallelJob_t *job, linkedList_t *list,
+                       threadPool_t *pool, linkedListHandle_t *filtered)
+{
+    parallelSegment_t single = { job, list, 0, (natural) -1, NULL, NULL, 0,
+                                 0 };
+    parallelSegment_t *split = &single;
+    natural segments = 1, size = 0;
+    int parallel = (pool != NULL && threadPoolSize(pool) >= 2);
+    int failed = 0;
+    threadPoolGroup_t group;
+    register natural i;
+
+    if (list == NULL) return 1;
+
+    /*a serial walk needs no first walk*/
+    if (parallel)
+    {
+        split = parallelSplit(job, list, PARALLEL_TASKS_PER_WORKER *
+                              threadPoolSize(pool), &segments, &size);
+        if (split == NULL)
+        {
+            printf("ERROR::out of memory, walking serially\n");
+            split    = &single;
+            segments = 1;
+            parallel = 0;
+        }
+    }
+
+    if (parallel && size >= LINKED_LIST_PARALLEL_THRESHOLD)
+    {
+        /*a group of its own: the walk may run inside a task, or share the
+          pool with other callers*/
+        threadPoolGroupInit(&group, pool);
+        for(i = 0; i < segments; i++)
+        {
+            threadPoolGroupSubmit(&group, parallelSegmentTask, &split[i]);
+        }
+        threadPoolGroupWait(&group);
+    }
+    else
+    {
+        for(i = 0; i < segments; i++) parallelSegmentTask(&split[i]);
+    }
+
+    if (job->kind == PARALLEL_FILTER)
+    {
+        for(i = 0; i < segments; i++) failed |= split[i].failed;
+
+        for(i = 0; i < segments; i++)
+        {
+            if (failed)
+            {
+                parallelRelease(job->allocator, split[i].head, split[i].tail);
+                continue;
+            }
+            if (split[i].head == NULL) continue;
+
+            if (filtered->tail == NULL) filtered->head = split[i].head;
+            else                        filtered->tail->next = split[i].head;
+            filtered->tail  = split[i].tail;
+            filtered->size += split[i].kept;
+        }
+    }
+
+    if (split != &single) free(split);
+
+    return !failed;
+}
+
+/******************************************************************************
+ * linkedListParallelMap                                                      *
+ ******************************************************************************
+ * description: replaces every value of the list by map(value, context), on   *
+ *              the workers of a thread pool. map is called concurrently.     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list    : receives the list address (e.g, list).      *
+ *      linkedListMap_t map     : gives the new value of a node.              *
+ *      void           *context : passed along to map.                        *
+ *      threadPool_t   *pool    : workers (NULL maps serially).               *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : the list, with the mapped values.           *
+ ******************************************************************************/
+void linkedListParallelMap(linkedList_t *list, linkedListMap_t map,
+                           void *context, threadPool_t *pool)
+{
+    parallelJob_t job = { PARALLEL_MAP, map, NULL, NULL, context, NULL, NULL };
+
+    parallelRun(&job, list, pool, NULL);
+}
+
+/******************************************************************************
+ * linkedListParallelFilter                                                   *
+ ******************************************************************************
+ * description: appends to a handle the values for which the predicate holds, *
+ *              in the same order, on the workers of a thread pool. Each      *
+ *              segment builds its own chain, with nodes from the allocator   *
+ *              of the handle (a block per stride when it gives blocks), and  *
+ *              the chains are spliced in order at the end.                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t          *list      : receives the list address.         *
+ *      linkedListPredicate_t  predicate : tells whether a value is kept.     *
+ *      void                  *context   : passed along to predicate.         *
+ *      linkedListHandle_t    *filtered  : receives the handle address.       *
+ *      threadPool_t          *pool      : workers (NULL filters serially).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                              : 1 with the values kept appended,   *
+ *                                         0 (and an error message) if the    *
+ *                                         allocator ran out of nodes, with   *
+ *                                         the handle left as it was.         *
+ ******************************************************************************/
+int linkedListParallelFilter(const linkedList_t *list,
+                             linkedListPredicate_t predicate, void *context,
+                             linkedListHandle_t *filtered, threadPool_t *pool)
+{
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    parallelJob_t job = { PARALLEL_FILTER, NULL, predicate, NULL, context,
+                          filtered->allocator, &lock };
+    int kept;
+
+    if (job.allocator == NULL) job.allocator = linkedListGetDefaultAllocator();
+
+    /*a filter only reads the nodes*/
+    kept = parallelRun(&job, (linkedList_t*) list, pool, filtered);
+    pthread_mutex_destroy(&lock);
+
+    if (!kept) printf("ERROR::out of memory, the filter kept nothing\n");
+
+    return kept;
+}
+
+/******************************************************************************
+ * linkedListParallelForEach                                                  *
+ ******************************************************************************
+ * description: calls visit(value, index, context) once for every node, on    *
+ *              the workers of a thread pool. Within a segment the nodes are  *
+ *              visited in order, but segments are visited concurrently.      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t     *list    : receives the list address (e.g, list).    *
+ *      linkedListVisit_t visit   : called for every node.                    *
+ *      void             *context : passed along to visit.                    *
+ *      threadPool_t     *pool    : workers (NULL visits serially).           *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                      : every node visited.                       *
+ ******************************************************************************/
+void linkedListParallelForEach(const linkedList_t *list,
+                               linkedListVisit_t visit, void *context,
+                               threadPool_t *pool)
+{
+    parallelJob_t job = { PARALLEL_FOR_EACH, NULL, NULL, visit, context,
+                          NULL, NULL };
+
+    /*a for-each only reads the nodes*/
+    parallelRun(&job, (linkedList_t*) list, pool, NULL);
+}
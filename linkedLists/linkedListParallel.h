@@ -0,0 +1,72 @@
+/******************************************************************************
+ *                      PARALLEL LINKED LIST WALKS                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * Element-wise map, filter and for-each, run on the workers of a thread      *
+ * pool. A first walk notes every LINKED_LIST_PARALLEL_STRIDE-th node, which  *
+ * cuts the list into segments (eight per worker), and the segments are then  *
+ * processed as tasks of the work-stealing pool.                              *
+ *                                                                            *
+ * The results do not depend on the number of workers nor on the order the    *
+ * segments run in, as long as the map and predicate functions only depend    *
+ * on their arguments:                                                        *
+ *                                                                            *
+ *  - map changes the values in place, with the nodes left as they were.      *
+ *  - filter appends the values kept, in the same order, to a handle: each    *
+ *    segment builds a chain from the allocator of the handle, and the chains *
+ *    are spliced in order. The allocator is called under a lock, so it need  *
+ *    not be thread-safe: a pool (linkedListPool.h) gives a block per stride  *
+ *    of kept values, the malloc allocator a node at a time. Running out of   *
+ *    nodes is reported apart from keeping nothing.                           *
+ *  - for-each calls visit once per node, with the node index, but the calls  *
+ *    of different segments run concurrently.                                 *
+ *                                                                            *
+ * The first walk is serial, so the speedup depends on the work per node:     *
+ * nothing is gained on a plain assignment, which is as cheap as the walk.    *
+ * Lists shorter than LINKED_LIST_PARALLEL_THRESHOLD, or a NULL pool, are     *
+ * walked serially by the caller.                                             *
+ *                                                                            *
+ * Each walk joins its own task group only, so it can be run from inside a    *
+ * task of the pool, or by many threads sharing it.                           *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_PARALLEL_H__
+#define __LINKED_LIST_PARALLEL_H__
+
+#include "linkedList.h"
+#include "threadPool.h"
+
+/*Nodes between two notes of the first walk*/
+#define LINKED_LIST_PARALLEL_STRIDE    1024
+/*Lists shorter than this are not worth the threads*/
+#define LINKED_LIST_PARALLEL_THRESHOLD 16384
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef real (*linkedListMap_t)(real data, void *context);
+typedef void (*linkedListVisit_t)(real data, natural index, void *context);
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void linkedListParallelMap(linkedList_t *list, linkedListMap_t map,
+                           void *context, threadPool_t *pool);
+int linkedListParallelFilter(const linkedList_t *list,
+                             linkedListPredicate_t predicate, void *context,
+                             linkedListHandle_t *filtered, threadPool_t *pool);
+void linkedListParallelForEach(const linkedList_t *list,
+                               linkedListVisit_t visit, void *context,
+                               threadPool_t *pool);
+
+#endif
+/*****END*****/
@@ -0,0 +1,350 @@
+/******************************************************************************
+ *                      PARALLEL LINKED LIST WALKS                            *
+ *                         CHECK AND BENCHMARK                                *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListParallelBench [threads] [size]                            *
+ *                                                                            *
+ * Runs map, filter and for-each of linkedListParallel.h on a list of size   *
+ * nodes, first serially (NULL pool), then on a work-stealing pool of threads *
+ * workers, and writes the time of both and the speedup. The parallel results *
+ * are checked to be bit for bit the serial ones: the exit code is 1 on any   *
+ * difference.                                                                *
+ *                                                                            *
+ * The heavy map is also run from inside pool tasks, and by two threads at    *
+ * once on the same pool, each one joining only its own walk; both must give  *
+ * the serial result too (and not hang).                                      *
+ *                                                                            *
+ * The filter is also run into a handle bound to a malloc allocator which     *
+ * counts its nodes: appended after a value already there, it must give the   *
+ * serial result, and when the allocator runs out halfway, it must report it, *
+ * give every node back and leave the handle empty.                           *
+ *                                                                            *
+ * The light map (one multiply-add per node) shows the cost of the serial     *
+ * first walk; the other ones do some tens of nanoseconds of work per node.   *
+ * The speedup is bounded by the number of processors the host actually has. *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+#include "linkedListParallel.h"
+#include "threadPool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+/*Iterations of the heavy kernel*/
+#define BENCH_WORK 16
+
+static double benchNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e3 + now.tv_nsec / 1e6;
+}
+
+static real benchHeavy(real data)
+{
+    register natural i;
+
+    for(i = 0; i < BENCH_WORK; i++) data = sqrt(data * data + 1.0) - 0.5;
+
+    return data;
+}
+
+static real benchMapLight(real data, void *context)
+{
+    (void) context;
+    return 2.0 * data + 1.0;
+}
+
+static real benchMapHeavy(real data, void *context)
+{
+    (void) context;
+    return benchHeavy(data);
+}
+
+static int benchKeep(real data, void *context)
+{
+    (void) context;
+    return fmod(benchHeavy(data), 1.0) < 0.5;
+}
+
+static void benchVisit(real data, natural index, void *context)
+{
+    ((real*) context)[index] = benchHeavy(data);
+}
+
+typedef struct benchResult
+{
+    double  milliseconds;
+    real   *values;       /*what the run produced*/
+    natural size;
+
+} benchResult_t;
+
+/*Runs one operation on a fresh list; the pool may be NULL*/
+static benchResult_t benchRun(const char *operation, const real *array,
+                              natural size, threadPool_t *pool)
+{
+    linkedList_t *list = linkedListFromArray(array, size);
+    linkedListHandle_t filtered;
+    benchResult_t result;
+    double start;
+
+    result.values = NULL;
+    result.size   = size;
+
+    if (strcmp(operation, "forEach") == 0)
+    {
+        result.values = (real*) malloc(size * sizeof(real));
+        start = benchNow();
+        linkedListParallelForEach(list, benchVisit, result.values, pool);
+        result.milliseconds = benchNow() - start;
+        return result;
+    }
+
+    if (strcmp(operation, "filter") == 0)
+    {
+        /*the nodes kept come from the default allocator too*/
+        linkedListHandleInit(&filtered);
+        start = benchNow();
+        linkedListParallelFilter(list, benchKeep, NULL, &filtered, pool);
+        result.milliseconds = benchNow() - start;
+        result.values = linkedListToArray(filtered.head, &result.size);
+        return result;
+    }
+
+    start = benchNow();
+    linkedListParallelMap(list, strcmp(operation, "mapLight") == 0 ?
+                          benchMapLight : benchMapHeavy, NULL, pool);
+    result.milliseconds = benchNow() - start;
+    result.values = linkedListToArray(list, &result.size);
+
+    return result;
+}
+
+/*A heavy map run by a pool task, or by a thread of its own*/
+typedef struct benchNested
+{
+    linkedList_t *list;
+    threadPool_t *pool;
+
+} benchNested_t;
+
+static void benchNestedTask(void *argument)
+{
+    benchNested_t *nested = (benchNested_t*) argument;
+    linkedListParallelMap(nested->list, benchMapHeavy, NULL, nested->pool);
+}
+
+static void *benchNestedThread(void *argument)
+{
+    benchNestedTask(argument);
+    return NULL;
+}
+
+/*Maps two lists from inside pool tasks, then from two threads at once*/
+static int benchNestedCheck(const real *array, natural size,
+                            threadPool_t *pool)
+{
+    benchResult_t serial = benchRun("mapHeavy", array, size, NULL);
+    benchNested_t nested[2];
+    threadPoolGroup_t group;
+    pthread_t threads[2];
+    natural round, mapped;
+    int passed = 1;
+    register natural i;
+
+    for(round = 0; round < 2; round++)
+    {
+        for(i = 0; i < 2; i++)
+        {
+            nested[i].list = linkedListFromArray(array, size);
+            nested[i].pool = pool;
+        }
+
+        if (round == 0)
+        {
+            threadPoolGroupInit(&group, pool);
+            for(i = 0; i < 2; i++)
+            {
+                threadPoolGroupSubmit(&group, benchNestedTask, &nested[i]);
+            }
+            threadPoolGroupWait(&group);
+        }
+        else
+        {
+            for(i = 0; i < 2; i++)
+            {
+                pthread_create(&threads[i], NULL, benchNestedThread,
+                               &nested[i]);
+            }
+            for(i = 0; i < 2; i++) pthread_join(threads[i], NULL);
+        }
+
+        for(i = 0; i < 2; i++)
+        {
+            real *values = linkedListToArray(nested[i].list, &mapped);
+            if (mapped != serial.size || memcmp(values, serial.values,
+                                                mapped * sizeof(real)) != 0)
+            {
+                printf("ERROR::%s map differs from the serial one\n",
+                       round == 0 ? "nested" : "concurrent");
+                passed = 0;
+            }
+            free(values);
+        }
+    }
+    free(serial.values);
+
+    return passed;
+}
+
+/*malloc nodes, up to a budget, counting the ones alive*/
+typedef struct benchBudget
+{
+    natural budget;
+    long    alive;
+
+} benchBudget_t;
+
+static linkedList_t *benchBudgetAlloc(void *context)
+{
+    benchBudget_t *budget = (benchBudget_t*) context;
+
+    if (budget->budget == 0) return NULL;
+    budget->budget--;
+    budget->alive++;
+
+    return (linkedList_t*) malloc(sizeof(linkedList_t));
+}
+
+static void benchBudgetRelease(void *context, linkedList_t *node)
+{
+    ((benchBudget_t*) context)->alive--;
+    free(node);
+}
+
+/*Filters into a handle bound to the budget allocator, then runs it out*/
+static int benchFilterCheck(const real *array, natural size,
+                            threadPool_t *pool)
+{
+    benchResult_t serial = benchRun("filter", array, size, NULL);
+    benchBudget_t budget = { (natural) -1, 0 };
+    linkedListAllocator_t allocator =
+    {
+        &budget, benchBudgetAlloc, NULL, benchBudgetRelease, NULL
+    };
+    linkedList_t *list = linkedListFromArray(array, size);
+    linkedListHandle_t filtered;
+    natural kept;
+    real *values;
+    int passed = 1;
+
+    linkedListHandleInitWith(&filtered, &allocator);
+    linkedListHandleAppend(&filtered, -1.0);
+    passed &= linkedListParallelFilter(list, benchKeep, NULL, &filtered, pool);
+
+    values = linkedListToArray(filtered.head, &kept);
+    if (!passed || kept != serial.size + 1 || filtered.size != kept ||
+        values[0] != -1.0 || filtered.tail->next != NULL ||
+        filtered.tail->data != values[kept - 1] ||
+        memcmp(values + 1, serial.values, serial.size * sizeof(real)) != 0)
+    {
+        printf("ERROR::filter into a handle differs from the serial one\n");
+        passed = 0;
+    }
+    free(values);
+    linkedListHandleFree(&filtered);
+
+    if (serial.size > 1)
+    {
+        budget.budget = serial.size / 2;
+        linkedListHandleInitWith(&filtered, &allocator);
+        if (linkedListParallelFilter(list, benchKeep, NULL, &filtered, pool) ||
+            filtered.head != NULL || filtered.size != 0 || budget.alive != 0)
+        {
+            printf("ERROR::filter did not report running out of nodes\n");
+            passed = 0;
+        }
+    }
+    free(serial.values);
+
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *operations[] =
+    {
+        "mapLight", "mapHeavy", "filter", "forEach"
+    };
+    natural threads = (argc > 1) ? (natural) atoi(argv[1]) : 4;
+    natural size    = (argc > 2) ? (natural) atoi(argv[2]) : 1000000;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    linkedListPool_t nodes;
+    threadPool_t pool;
+    int passed = 1;
+    register natural i, o;
+
+    if (threads < 2) threads = 2;
+
+    real *array = (real*) malloc(size * sizeof(real));
+    for(i = 0; i < size; i++) array[i] = (real) ((i * 2654435761u) % 100003);
+
+    /*every list is carved from the pool, and given back at once at the end*/
+    linkedListPoolInit(&nodes, 65536);
+    linkedListSetDefaultAllocator(linkedListPoolAllocator(&nodes));
+    threadPoolInit(&pool, threads);
+
+    printf("linkedList::parallel::[ threads %d size %d processors %ld ]\n",
+           threadPoolSize(&pool), size, online);
+
+    for(o = 0; o < sizeof(operations) / sizeof(operations[0]); o++)
+    {
+        benchResult_t serial   = benchRun(operations[o], array, size, NULL);
+        benchResult_t parallel = benchRun(operations[o], array, size, &pool);
+
+        if (serial.size != parallel.size || (serial.size > 0 &&
+            memcmp(serial.values, parallel.values,
+                   serial.size * sizeof(real)) != 0))
+        {
+            printf("ERROR::parallel %s differs from the serial one\n",
+                   operations[o]);
+            passed = 0;
+        }
+
+        printf("linkedList::parallel::%s::[ serial_ms %.2f parallel_ms %.2f "
+               "speedup %.2f ]\n", operations[o], serial.milliseconds,
+               parallel.milliseconds,
+               serial.milliseconds / parallel.milliseconds);
+
+        free(serial.values);
+        free(parallel.values);
+    }
+
+    passed &= benchNestedCheck(array, size, &pool);
+    printf("linkedList::parallel::nested::[ %s ]\n",
+           passed ? "passed" : "failed");
+
+    passed &= benchFilterCheck(array, size, &pool);
+    printf("linkedList::parallel::filterHandle::[ %s ]\n",
+           passed ? "passed" : "failed");
+
+    threadPoolDestroy(&pool);
+    linkedListSetDefaultAllocator(NULL);
+    linkedListPoolDestroy(&nodes);
+    free(array);
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,341 @@
+/******************************************************************************
+ *                           LINKED LIST NODE POOL                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListPool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+/*Blocks and chunk headers are kept aligned as malloc would align them*/
+#define POOL_ALIGNMENT   (_Alignof(max_align_t))
+#define POOL_ROUND(size) (((size) + POOL_ALIGNMENT - 1) & ~(POOL_ALIGNMENT - 1))
+#define POOL_HEADER_SIZE POOL_ROUND(sizeof(linkedListPoolChunk_t))
+
+/*The free-list link lives where a linkedList_t keeps its next pointer*/
+#define POOL_LINK(block) \
+    (((linkedList_t*) (block))->next)
+
+static char *linkedListPoolBlock(const linkedListPool_t *pool, 
+                                 linkedListPoolChunk_t *chunk, natural i)
+{
+    return (char*) chunk + POOL_HEADER_SIZE + (size_t) i * pool->blockSize;
+}
+
+/*Moves the carving to the next chunk with room for at least minimum blocks.
+  After a reset, the next chunks already exist, otherwise a new one is taken
+  from the system and linked right after the current chunk, so a reset carves
+  the chunks again in the same order.*/
+static linkedListPoolChunk_t *linkedListPoolNextChunk(linkedListPool_t *pool,
+                                                      natural minimum)
+{
+    linkedListPoolChunk_t *chunk = (pool->current != NULL) 
+                                 ? pool->current->next : pool->chunks;
+
+    if (chunk == NULL || chunk->capacity < minimum)
+    {
+        natural capacity = (minimum > pool->blocksPerChunk) 
+                         ? minimum : pool->blocksPerChunk;
+        linkedListPoolChunk_t *newChunk = (linkedListPoolChunk_t*) malloc(
+            POOL_HEADER_SIZE + (size_t) capacity * pool->blockSize);
+        if (newChunk == NULL)
+        {
+            printf("ERROR::pool is out of memory\n");
+            return NULL;
+        }
+        newChunk->next     = chunk;
+        newChunk->capacity = capacity;
+
+        if (pool->current != NULL) pool->current->next = newChunk;
+        else                       pool->chunks        = newChunk;
+        chunk = newChunk;
+    }
+
+    pool->current = chunk;
+    pool->carved  = 0;
+
+    return chunk;
+}
+
+/*Hands the uncarved blocks of the current chunk to the free-list, in their
+  address order, so that they are recycled before the next chunk is carved*/
+static void linkedListPoolRetire(linkedListPool_t *pool)
+{
+    natural i;
+
+    if (pool->current == NULL) return ;
+
+    for(i = pool->current->capacity; i > pool->carved; i--)
+    {
+        linkedListPoolRelease(pool, linkedListPoolBlock(pool, pool->current,
+                                                        i - 1));
+    }
+    pool->carved = pool->current->capacity;
+}
+
+static linkedList_t *linkedListPoolAllocNode(void *context)
+{
+    return (linkedList_t*) linkedListPoolAlloc((linkedListPool_t*) context);
+}
+
+static linkedList_t *linkedListPoolAllocNodes(void *context, natural count)
+{
+    return (linkedList_t*) linkedListPoolAllocBlock((linkedListPool_t*) context,
+                                                    count);
+}
+
+static void linkedListPoolReleaseNode(void *context, linkedList_t *node)
+{
+    linkedListPoolRelease((linkedListPool_t*) context, node);
+}
+
+static void linkedListPoolReleaseChain(void *context, linkedList_t *head, 
+                                       linkedList_t *tail)
+{
+    linkedListPoolReleaseList((linkedListPool_t*) context, head, tail);
+}
+
+/******************************************************************************
+ * linkedListPoolInit                                                         *
+ ******************************************************************************
+ * description: initializes a pool of linkedList_t nodes. No memory is taken  *
+ *              until the first allocation.                                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool           : receives the pool address (&pool). *
+ *      natural           blocksPerChunk : nodes carved from each chunk.      *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                             : an empty pool.                     *
+ ******************************************************************************/
+void linkedListPoolInit(linkedListPool_t *pool, natural blocksPerChunk)
+{
+    linkedListPoolInitSized(pool, sizeof(linkedList_t), blocksPerChunk);
+}
+
+/******************************************************************************
+ * linkedListPoolInitSized                                                    *
+ ******************************************************************************
+ * description: initializes a pool of blocks of any size, as long as they are *
+ *              at least as large as a linkedList_t node (the free-list link  *
+ *              is stored in the released blocks).                            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool           : receives the pool address (&pool). *
+ *      size_t            blockSize      : size of each block in bytes.       *
+ *      natural           blocksPerChunk : blocks carved from each chunk.     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                             : an empty pool.                     *
+ ******************************************************************************/
+void linkedListPoolInitSized(linkedListPool_t *pool, size_t blockSize, 
+                             natural blocksPerChunk)
+{
+    if (blockSize < sizeof(linkedList_t)) blockSize = sizeof(linkedList_t);
+    if (blocksPerChunk == 0) blocksPerChunk = 1;
+
+    pool->blockSize      = POOL_ROUND(blockSize);
+    pool->blocksPerChunk = blocksPerChunk;
+    pool->chunks         = NULL;
+    pool->current        = NULL;
+    pool->carved         = 0;
+    pool->freeList       = NULL;
+
+    pool->allocator.context     = pool;
+    pool->allocator.alloc       = linkedListPoolAllocNode;
+    pool->allocator.allocBlock  = linkedListPoolAllocNodes;
+    pool->allocator.release     = linkedListPoolReleaseNode;
+    pool->allocator.releaseList = linkedListPoolReleaseChain;
+}
+
+/******************************************************************************
+ * linkedListPoolAlloc                                                        *
+ ******************************************************************************
+ * description: gives a block, recycling a released one when there is any.    *
+ *              Otherwise, the block is carved from the current chunk, and a  *
+ *              new chunk is only requested when the last one is exhausted.   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void*                   : an uninitialized block (NULL, and an error  *
+ *                                message, if the system is out of memory).   *
+ ******************************************************************************/
+void *linkedListPoolAlloc(linkedListPool_t *pool)
+{
+    /*Recycling a released block*/
+    if (pool->freeList != NULL)
+    {
+        linkedList_t *block = pool->freeList;
+        pool->freeList = POOL_LINK(block);
+        return block;
+    }
+
+    /*Moving to the next chunk, when the current one is exhausted*/
+    if (pool->current == NULL || pool->carved == pool->current->capacity)
+    {
+        if (linkedListPoolNextChunk(pool, 1) == NULL) return NULL;
+    }
+
+    return linkedListPoolBlock(pool, pool->current, pool->carved++);
+}
+
+/******************************************************************************
+ * linkedListPoolAllocBlock                                                   *
+ ******************************************************************************
+ * description: gives count contiguous blocks, carved at once from a single   *
+ *              chunk. Each one of them can later be released on its own.     *
+ *              When they do not fit in the current chunk, its uncarved       *
+ *              blocks are released, and later single allocations take them.  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *      natural           count : number of contiguous blocks.                *
+ *                                                                            *
+ * output:                                                                    *
+ *      void*                   : the first of the uninitialized blocks (NULL *
+ *                                if count is 0 or the system is out of       *
+ *                                memory).                                    *
+ ******************************************************************************/
+void *linkedListPoolAllocBlock(linkedListPool_t *pool, natural count)
+{
+    if (count == 0) return NULL;
+
+    /*the rest of a chunk too small is not lost: it goes to the free-list*/
+    if (pool->current == NULL || pool->current->capacity - pool->carved < count)
+    {
+        linkedListPoolRetire(pool);
+        if (linkedListPoolNextChunk(pool, count) == NULL) return NULL;
+    }
+
+    void *block = linkedListPoolBlock(pool, pool->current, pool->carved);
+    pool->carved += count;
+
+    return block;
+}
+
+/******************************************************************************
+ * linkedListPoolRelease                                                      *
+ ******************************************************************************
+ * description: gives a block back to the pool, to be recycled.               *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *      void             *block : a block given by this pool.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : the block is in the free-list.              *
+ ******************************************************************************/
+void linkedListPoolRelease(linkedListPool_t *pool, void *block)
+{
+    if (block == NULL) return ;
+
+    POOL_LINK(block) = pool->freeList;
+    pool->freeList = (linkedList_t*) block;
+}
+
+/******************************************************************************
+ * linkedListPoolReleaseList                                                  *
+ ******************************************************************************
+ * description: gives a whole list back to the pool in O(1). The nodes are    *
+ *              already chained by their next pointers, so the tail is just   *
+ *              hooked to the free-list.                                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *      linkedList_t     *head  : first node of the list.                     *
+ *      linkedList_t     *tail  : last node of the list.                      *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : every node of the list is in the free-list. *
+ ******************************************************************************/
+void linkedListPoolReleaseList(linkedListPool_t *pool, linkedList_t *head, 
+                               linkedList_t *tail)
+{
+    if (head == NULL) return ;
+
+    /*Without a known tail, it has to be found*/
+    if (tail == NULL)
+    {
+        tail = head;
+        while(tail->next != NULL) tail = tail->next;
+    }
+
+    tail->next = pool->freeList;
+    pool->freeList = head;
+}
+
+/******************************************************************************
+ * linkedListPoolReset                                                        *
+ ******************************************************************************
+ * description: releases every block of the pool at once. The chunks are kept *
+ *              to be carved again, so every list built from the pool becomes *
+ *              invalid.                                                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : a pool with all its blocks available.       *
+ ******************************************************************************/
+void linkedListPoolReset(linkedListPool_t *pool)
+{
+    pool->current  = pool->chunks;
+    pool->carved   = 0;
+    pool->freeList = NULL;
+}
+
+/******************************************************************************
+ * linkedListPoolDestroy                                                      *
+ ******************************************************************************
+ * description: gives every chunk back to the system. The pool is left empty  *
+ *              and can still be used.                                        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                    : a pool without memory.                      *
+ ******************************************************************************/
+void linkedListPoolDestroy(linkedListPool_t *pool)
+{
+    linkedListPoolChunk_t *chunk = pool->chunks;
+    linkedListPoolChunk_t *nextChunk = NULL;
+
+    while(chunk != NULL)
+    {
+        nextChunk = chunk->next;
+        free(chunk);
+        chunk = nextChunk;
+    }
+
+    pool->chunks   = NULL;
+    pool->current  = NULL;
+    pool->carved   = 0;
+    pool->freeList = NULL;
+}
+
+/******************************************************************************
+ * linkedListPoolAllocator                                                    *
+ ******************************************************************************
+ * description: returns the pool as a node allocator, which can be bound to a *
+ *              list handle or set as the default allocator.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListPool_t *pool  : receives the pool address (&pool).          *
+ *                                                                            *
+ * output:                                                                    *
+ *      linkedListAllocator_t*  : the allocator view of the pool.             *
+ ******************************************************************************/
+const linkedListAllocator_t *linkedListPoolAllocator(linkedListPool_t *pool)
+{
+    return &pool->allocator;
+}
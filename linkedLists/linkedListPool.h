@@ -0,0 +1,74 @@
+/******************************************************************************
+ *                           LINKED LIST NODE POOL                            *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * This is a slab (arena) allocator for fixed-size blocks. The blocks are     *
+ * carved from large chunks, and the released ones are kept in a free-list to *
+ * be recycled, so there is one malloc per chunk instead of one per node.     *
+ * Many contiguous blocks can also be carved at once, as bulk construction    *
+ * does (e.g., linkedListFromArray).                                          *
+ *                                                                            *
+ * Free blocks are chained through the same word that holds the next pointer  *
+ * of a linkedList_t node. Thus, a whole list can be given back to the pool   *
+ * in O(1): its tail is hooked to the free-list. The whole pool can also be   *
+ * reset at once, or destroyed, which returns the chunks to the system.       *
+ *                                                                            *
+ * linkedListPoolAllocator gives the linkedListAllocator_t view of the pool,  *
+ * which can be bound to a list handle (linkedListHandleInitWith).            *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_POOL_H__
+#define __LINKED_LIST_POOL_H__
+
+#include "linkedList.h"
+
+#include <stddef.h>
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct linkedListPoolChunk
+{
+    struct linkedListPoolChunk *next;
+    natural                     capacity;
+
+} linkedListPoolChunk_t;
+
+typedef struct linkedListPool
+{
+    size_t                 blockSize;
+    natural                blocksPerChunk;
+    linkedListPoolChunk_t *chunks;     /*oldest chunk first*/
+    linkedListPoolChunk_t *current;    /*chunk being carved*/
+    natural                carved;     /*blocks already carved from current*/
+    linkedList_t          *freeList;
+    linkedListAllocator_t  allocator;
+
+} linkedListPool_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void linkedListPoolInit(linkedListPool_t *pool, natural blocksPerChunk);
+void linkedListPoolInitSized(linkedListPool_t *pool, size_t blockSize, 
+                             natural blocksPerChunk);
+void *linkedListPoolAlloc(linkedListPool_t *pool);
+void *linkedListPoolAllocBlock(linkedListPool_t *pool, natural count);
+void linkedListPoolRelease(linkedListPool_t *pool, void *block);
+void linkedListPoolReleaseList(linkedListPool_t *pool, linkedList_t *head, 
+                               linkedList_t *tail);
+void linkedListPoolReset(linkedListPool_t *pool);
+void linkedListPoolDestroy(linkedListPool_t *pool);
+const linkedListAllocator_t *linkedListPoolAllocator(linkedListPool_t *pool);
+
+#endif
+/*****END*****/
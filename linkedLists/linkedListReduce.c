@@ -0,0 +1,777 @@
+/******************************************************************************
+ *                       LINKED LIST BULK REDUCTIONS                          *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListReduce.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LINKED_LIST_REDUCE_X86 1
+#include <immintrin.h>
+#endif
+
+/*Number of values gathered from the nodes before calling a kernel*/
+#define REDUCE_BLOCK 256
+
+/******************************************************************************
+ * KERNELS                                                                    *
+ ******************************************************************************
+ * Every kernel reduces a contiguous block of n > 0 values.                   *
+ ******************************************************************************/
+typedef struct linkedListReduceKernels
+{
+    const char *name;
+    real (*sum)(const real *block, natural n);
+    real (*min)(const real *block, natural n);
+    real (*max)(const real *block, natural n);
+    real (*deviation)(const real *block, natural n, real mean);
+    real (*dot)(const real *first, const real *second, natural n);
+
+} linkedListReduceKernels_t;
+
+static real scalarSum(const real *block, natural n)
+{
+    real sum = 0;
+    register natural i;
+    for(i = 0; i < n; i++) sum += block[i];
+    return sum;
+}
+
+static real scalarMin(const real *block, natural n)
+{
+    real min = block[0];
+    register natural i;
+    for(i = 1; i < n; i++) if (block[i] < min) min = block[i];
+    return min;
+}
+
+static real scalarMax(const real *block, natural n)
+{
+    real max = block[0];
+    register natural i;
+    for(i = 1; i < n; i++) if (block[i] > max) max = block[i];
+    return max;
+}
+
+static real scalarDeviation(const real *block, natural n, real mean)
+{
+    real sum = 0;
+    register natural i;
+    for(i = 0; i < n; i++) sum += (block[i] - mean) * (block[i] - mean);
+    return sum;
+}
+
+static real scalarDot(const real *first, const real *second, natural n)
+{
+    real sum = 0;
+    register natural i;
+    for(i = 0; i < n; i++) sum += first[i] * second[i];
+    return sum;
+}
+
+static const linkedListReduceKernels_t scalarKernels = 
+{
+    "scalar", scalarSum, scalarMin, scalarMax, scalarDeviation, scalarDot
+};
+
+#ifdef LINKED_LIST_REDUCE_X86
+
+__attribute__((target("sse2")))
+static real sse2Sum(const real *block, natural n)
+{
+    __m128d a = _mm_setzero_pd(), b = _mm_setzero_pd();
+    natural i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        a = _mm_add_pd(a, _mm_loadu_pd(block + i));
+        b = _mm_add_pd(b, _mm_loadu_pd(block + i + 2));
+    }
+    a = _mm_add_pd(a, b);
+    real sum = _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+    for(; i < n; i++) sum += block[i];
+    return sum;
+}
+
+__attribute__((target("sse2")))
+static real sse2Min(const real *block, natural n)
+{
+    if (n < 2) return scalarMin(block, n);
+
+    __m128d a = _mm_loadu_pd(block);
+    natural i = 2;
+    for(; i + 2 <= n; i += 2) a = _mm_min_pd(a, _mm_loadu_pd(block + i));
+    a = _mm_min_sd(a, _mm_unpackhi_pd(a, a));
+    real min = _mm_cvtsd_f64(a);
+    for(; i < n; i++) if (block[i] < min) min = block[i];
+    return min;
+}
+
+__attribute__((target("sse2")))
+static real sse2Max(const real *block, natural n)
+{
+    if (n < 2) return scalarMax(block, n);
+
+    __m128d a = _mm_loadu_pd(block);
+    natural i = 2;
+    for(; i + 2 <= n; i += 2) a = _mm_max_pd(a, _mm_loadu_pd(block + i));
+    a = _mm_max_sd(a, _mm_unpackhi_pd(a, a));
+    real max = _mm_cvtsd_f64(a);
+    for(; i < n; i++) if (block[i] > max) max = block[i];
+    return max;
+}
+
+__attribute__((target("sse2")))
+static real sse2Deviation(const real *block, natural n, real mean)
+{
+    __m128d m = _mm_set1_pd(mean);
+    __m128d a = _mm_setzero_pd();
+    natural i = 0;
+    for(; i + 2 <= n; i += 2)
+    {
+        __m128d d = _mm_sub_pd(_mm_loadu_pd(block + i), m);
+        a = _mm_add_pd(a, _mm_mul_pd(d, d));
+    }
+    real sum = _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+    for(; i < n; i++) sum += (block[i] - mean) * (block[i] - mean);
+    return sum;
+}
+
+__attribute__((target("sse2")))
+static real sse2Dot(const real *first, const real *second, natural n)
+{
+    __m128d a = _mm_setzero_pd(), b = _mm_setzero_pd();
+    natural i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        a = _mm_add_pd(a, _mm_mul_pd(_mm_loadu_pd(first + i), 
+                                     _mm_loadu_pd(second + i)));
+        b = _mm_add_pd(b, _mm_mul_pd(_mm_loadu_pd(first + i + 2), 
+                                     _mm_loadu_pd(second + i + 2)));
+    }
+    a = _mm_add_pd(a, b);
+    real sum = _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+    for(; i < n; i++) sum += first[i] * second[i];
+    return sum;
+}
+
+static const linkedListReduceKernels_t sse2Kernels = 
+{
+    "sse2", sse2Sum, sse2Min, sse2Max, sse2Deviation, sse2Dot
+};
+
+__attribute__((target("avx2")))
+static real avx2Horizontal(__m256d a)
+{
+    __m128d low = _mm_add_pd(_mm256_castpd256_pd128(a), 
+                             _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+}
+
+__attribute__((target("avx2")))
+static real avx2Sum(const real *block, natural n)
+{
+    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd();
+    natural i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        a = _mm256_add_pd(a, _mm256_loadu_pd(block + i));
+        b = _mm256_add_pd(b, _mm256_loadu_pd(block + i + 4));
+    }
+    real sum = avx2Horizontal(_mm256_add_pd(a, b));
+    for(; i < n; i++) sum += block[i];
+    return sum;
+}
+
+__attribute__((target("avx2")))
+static real avx2Min(const real *block, natural n)
+{
+    if (n < 4) return scalarMin(block, n);
+
+    __m256d a = _mm256_loadu_pd(block);
+    natural i = 4;
+    for(; i + 4 <= n; i += 4) a = _mm256_min_pd(a, _mm256_loadu_pd(block + i));
+    __m128d low = _mm_min_pd(_mm256_castpd256_pd128(a), 
+                             _mm256_extractf128_pd(a, 1));
+    real min = _mm_cvtsd_f64(_mm_min_sd(low, _mm_unpackhi_pd(low, low)));
+    for(; i < n; i++) if (block[i] < min) min = block[i];
+    return min;
+}
+
+__attribute__((target("avx2")))
+static real avx2Max(const real *block, natural n)
+{
+    if (n < 4) return scalarMax(block, n);
+
+    __m256d a = _mm256_loadu_pd(block);
+    natural i = 4;
+    for(; i + 4 <= n; i += 4) a = _mm256_max_pd(a, _mm256_loadu_pd(block + i));
+    __m128d low = _mm_max_pd(_mm256_castpd256_pd128(a), 
+                             _mm256_extractf128_pd(a, 1));
+    real max = _mm_cvtsd_f64(_mm_max_sd(low, _mm_unpackhi_pd(low, low)));
+    for(; i < n; i++) if (block[i] > max) max = block[i];
+    return max;
+}
+
+__attribute__((target("avx2")))
+static real avx2Deviation(const real *block, natural n, real mean)
+{
+    __m256d m = _mm256_set1_pd(mean);
+    __m256d a = _mm256_setzero_pd();
+    natural i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m256d d = _mm256_sub_pd(_mm256_loadu_pd(block + i), m);
+        a = _mm256_add_pd(a, _mm256_mul_pd(d, d));
+    }
+    real sum = avx2Horizontal(a);
+    for(; i < n; i++) sum += (block[i] - mean) * (block[i] - mean);
+    return sum;
+}
+
+__attribute__((target("avx2")))
+static real avx2Dot(const real *first, const real *second, natural n)
+{
+    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd();
+    natural i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        a = _mm256_add_pd(a, _mm256_mul_pd(_mm256_loadu_pd(first + i), 
+                                           _mm256_loadu_pd(second + i)));
+        b = _mm256_add_pd(b, _mm256_mul_pd(_mm256_loadu_pd(first + i + 4), 
+                                           _mm256_loadu_pd(second + i + 4)));
+    }
+    real sum = avx2Horizontal(_mm256_add_pd(a, b));
+    for(; i < n; i++) sum += first[i] * second[i];
+    return sum;
+}
+
+static const linkedListReduceKernels_t avx2Kernels = 
+{
+    "avx2", avx2Sum, avx2Min, avx2Max, avx2Deviation, avx2Dot
+};
+
+#endif
+
+/*Read by every reduction, possibly from many threads at once: it is only
+  loaded and stored atomically, and the automatic choice is made once*/
+static const linkedListReduceKernels_t *reduceKernels = NULL;
+static pthread_once_t reduceKernelsOnce = PTHREAD_ONCE_INIT;
+
+static void linkedListReduceAuto(void)
+{
+    if (__atomic_load_n(&reduceKernels, __ATOMIC_ACQUIRE) == NULL)
+    {
+        linkedListReduceSelect(LINKED_LIST_REDUCE_AUTO);
+    }
+}
+
+static const linkedListReduceKernels_t *linkedListReduceKernels(void)
+{
+    const linkedListReduceKernels_t *kernels =
+        __atomic_load_n(&reduceKernels, __ATOMIC_ACQUIRE);
+
+    if (kernels == NULL)
+    {
+        pthread_once(&reduceKernelsOnce, linkedListReduceAuto);
+        kernels = __atomic_load_n(&reduceKernels, __ATOMIC_ACQUIRE);
+    }
+
+    return kernels;
+}
+
+/*Copies the next values of the list into the block, moving the list*/
+static natural linkedListGather(const linkedList_t **list, real *block)
+{
+    const linkedList_t *current = *list;
+    natural n = 0;
+
+    while(current != NULL && n < REDUCE_BLOCK)
+    {
+        block[n++] = current->data;
+        current = current->next;
+    }
+    *list = current;
+
+    return n;
+}
+
+/******************************************************************************
+ * linkedListReduceSelect                                                     *
+ ******************************************************************************
+ * description: chooses the kernels used by the reductions. AUTO picks the    *
+ *              widest instruction set supported by the processor, and a set  *
+ *              that is not supported falls back to the next narrower one.    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListReduceIsa_t isa : desired instruction set.                  *
+ *                                                                            *
+ * output:                                                                    *
+ *      linkedListReduceIsa_t     : instruction set actually chosen.          *
+ ******************************************************************************/
+linkedListReduceIsa_t linkedListReduceSelect(linkedListReduceIsa_t isa)
+{
+    const linkedListReduceKernels_t *kernels = &scalarKernels;
+    linkedListReduceIsa_t chosen = LINKED_LIST_REDUCE_SCALAR;
+
+#ifdef LINKED_LIST_REDUCE_X86
+    __builtin_cpu_init();
+    if (isa == LINKED_LIST_REDUCE_AUTO) isa = LINKED_LIST_REDUCE_AVX2;
+
+    if (isa == LINKED_LIST_REDUCE_AVX2 && __builtin_cpu_supports("avx2"))
+    {
+        kernels = &avx2Kernels;
+        chosen  = LINKED_LIST_REDUCE_AVX2;
+    }
+    else if (isa != LINKED_LIST_REDUCE_SCALAR &&
+             __builtin_cpu_supports("sse2"))
+    {
+        kernels = &sse2Kernels;
+        chosen  = LINKED_LIST_REDUCE_SSE2;
+    }
+#else
+    (void) isa;
+#endif
+
+    __atomic_store_n(&reduceKernels, kernels, __ATOMIC_RELEASE);
+
+    return chosen;
+}
+
+/******************************************************************************
+ * linkedListReduceName                                                       *
+ ******************************************************************************
+ * description: returns the name of the kernels in use (e.g., "avx2").        *
+ ******************************************************************************
+ * output:                                                                    *
+ *      const char*               : name of the instruction set.              *
+ ******************************************************************************/
+const char *linkedListReduceName(void)
+{
+    return linkedListReduceKernels()->name;
+}
+
+/******************************************************************************
+ * linkedListSum                                                              *
+ ******************************************************************************
+ * description: sums every value of the list.                                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : sum of the values (0 for an empty list).      *
+ ******************************************************************************/
+real linkedListSum(const linkedList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real block[REDUCE_BLOCK];
+    real sum = 0;
+    natural n;
+
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        sum += kernels->sum(block, n);
+    }
+
+    return sum;
+}
+
+/******************************************************************************
+ * linkedListMin                                                              *
+ ******************************************************************************
+ * description: finds the smallest value of the list.                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : smallest value (-1 and an error message for   *
+ *                              an empty list).                               *
+ ******************************************************************************/
+real linkedListMin(const linkedList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real block[REDUCE_BLOCK];
+    real min, value;
+    natural n;
+
+    if (list == NULL)
+    {
+        printf("ERROR::list is empty\n");
+        return -1;
+    }
+
+    min = list->data;
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        value = kernels->min(block, n);
+        if (value < min) min = value;
+    }
+
+    return min;
+}
+
+/******************************************************************************
+ * linkedListMax                                                              *
+ ******************************************************************************
+ * description: finds the largest value of the list.                          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : largest value (-1 and an error message for an *
+ *                              empty list).                                  *
+ ******************************************************************************/
+real linkedListMax(const linkedList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real block[REDUCE_BLOCK];
+    real max, value;
+    natural n;
+
+    if (list == NULL)
+    {
+        printf("ERROR::list is empty\n");
+        return -1;
+    }
+
+    max = list->data;
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        value = kernels->max(block, n);
+        if (value > max) max = value;
+    }
+
+    return max;
+}
+
+/******************************************************************************
+ * linkedListMean                                                             *
+ ******************************************************************************
+ * description: computes the arithmetic mean of the values of the list.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : mean of the values (0 for an empty list).     *
+ ******************************************************************************/
+real linkedListMean(const linkedList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real block[REDUCE_BLOCK];
+    real sum = 0;
+    natural n, count = 0;
+
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        sum   += kernels->sum(block, n);
+        count += n;
+    }
+
+    return (count > 0) ? sum / count : 0;
+}
+
+/******************************************************************************
+ * linkedListVariance                                                         *
+ ******************************************************************************
+ * description: computes the population variance of the values of the list,   *
+ *              with a first pass for the mean and a second one for the       *
+ *              squared deviations.                                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *list  : receives the list (e.g, list).                *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : variance of the values (0 for an empty list). *
+ ******************************************************************************/
+real linkedListVariance(const linkedList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real block[REDUCE_BLOCK];
+    real mean = linkedListMean(list);
+    real sum = 0;
+    natural n, count = 0;
+
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        sum   += kernels->deviation(block, n, mean);
+        count += n;
+    }
+
+    return (count > 0) ? sum / count : 0;
+}
+
+/******************************************************************************
+ * linkedListCountIf                                                          *
+ ******************************************************************************
+ * description: counts the values of the list for which the predicate holds.  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t          *list      : receives the list (e.g, list).     *
+ *      linkedListPredicate_t  predicate : returns non-zero for a match.      *
+ *      void                  *context   : passed along to the predicate.     *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural                          : number of matching values.         *
+ ******************************************************************************/
+natural linkedListCountIf(const linkedList_t *list, 
+                          linkedListPredicate_t predicate, void *context)
+{
+    real block[REDUCE_BLOCK];
+    natural n, count = 0;
+    register natural i;
+
+    while((n = linkedListGather(&list, block)) > 0)
+    {
+        for(i = 0; i < n; i++) count += (predicate(block[i], context) != 0);
+    }
+
+    return count;
+}
+
+/******************************************************************************
+ * linkedListDot                                                              *
+ ******************************************************************************
+ * description: computes the dot product of two lists. If the lengths differ, *
+ *              the extra values of the longer list are ignored.              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t   *first  : receives the first list.                     *
+ *      linkedList_t   *second : receives the second list.                    *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                   : dot product (0 if a list is empty).          *
+ ******************************************************************************/
+real linkedListDot(const linkedList_t *first, const linkedList_t *second)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    real firstBlock[REDUCE_BLOCK], secondBlock[REDUCE_BLOCK];
+    real sum = 0;
+    natural n, m;
+
+    while((n = linkedListGather(&first, firstBlock)) > 0 &&
+          (m = linkedListGather(&second, secondBlock)) > 0)
+    {
+        sum += kernels->dot(firstBlock, secondBlock, (n < m) ? n : m);
+    }
+
+    return sum;
+}
+
+/******************************************************************************
+ * unrolledListSum                                                            *
+ ******************************************************************************
+ * description: sums every value of an unrolled list. The values of each node *
+ *              are contiguous, so they are reduced in place.                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : sum of the values (0 for an empty list).      *
+ ******************************************************************************/
+real unrolledListSum(const unrolledList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    const unrolledListNode_t *current;
+    real sum = 0;
+
+    for(current = list->head; current != NULL; current = current->next)
+    {
+        sum += kernels->sum(current->data, current->count);
+    }
+
+    return sum;
+}
+
+/******************************************************************************
+ * unrolledListMin                                                            *
+ ******************************************************************************
+ * description: finds the smallest value of an unrolled list.                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : smallest value (-1 and an error message for   *
+ *                              an empty list).                               *
+ ******************************************************************************/
+real unrolledListMin(const unrolledList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    const unrolledListNode_t *current;
+    real min, value;
+
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return -1;
+    }
+
+    min = list->head->data[0];
+    for(current = list->head; current != NULL; current = current->next)
+    {
+        value = kernels->min(current->data, current->count);
+        if (value < min) min = value;
+    }
+
+    return min;
+}
+
+/******************************************************************************
+ * unrolledListMax                                                            *
+ ******************************************************************************
+ * description: finds the largest value of an unrolled list.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : largest value (-1 and an error message for an *
+ *                              empty list).                                  *
+ ******************************************************************************/
+real unrolledListMax(const unrolledList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    const unrolledListNode_t *current;
+    real max, value;
+
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return -1;
+    }
+
+    max = list->head->data[0];
+    for(current = list->head; current != NULL; current = current->next)
+    {
+        value = kernels->max(current->data, current->count);
+        if (value > max) max = value;
+    }
+
+    return max;
+}
+
+/******************************************************************************
+ * unrolledListMean                                                           *
+ ******************************************************************************
+ * description: computes the arithmetic mean of an unrolled list.             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : mean of the values (0 for an empty list).     *
+ ******************************************************************************/
+real unrolledListMean(const unrolledList_t *list)
+{
+    return (list->size > 0) ? unrolledListSum(list) / list->size : 0;
+}
+
+/******************************************************************************
+ * unrolledListVariance                                                       *
+ ******************************************************************************
+ * description: computes the population variance of an unrolled list.         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : variance of the values (0 for an empty list). *
+ ******************************************************************************/
+real unrolledListVariance(const unrolledList_t *list)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    const unrolledListNode_t *current;
+    real mean = unrolledListMean(list);
+    real sum = 0;
+
+    if (list->size == 0) return 0;
+
+    for(current = list->head; current != NULL; current = current->next)
+    {
+        sum += kernels->deviation(current->data, current->count, mean);
+    }
+
+    return sum / list->size;
+}
+
+/******************************************************************************
+ * unrolledListCountIf                                                        *
+ ******************************************************************************
+ * description: counts the values of an unrolled list for which the predicate *
+ *              holds.                                                        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t        *list      : receives the list address.         *
+ *      linkedListPredicate_t  predicate : returns non-zero for a match.      *
+ *      void                  *context   : passed along to the predicate.     *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural                          : number of matching values.         *
+ ******************************************************************************/
+natural unrolledListCountIf(const unrolledList_t *list, 
+                            linkedListPredicate_t predicate, void *context)
+{
+    const unrolledListNode_t *current;
+    natural count = 0;
+    register natural i;
+
+    for(current = list->head; current != NULL; current = current->next)
+    {
+        for(i = 0; i < current->count; i++)
+        {
+            count += (predicate(current->data[i], context) != 0);
+        }
+    }
+
+    return count;
+}
+
+/******************************************************************************
+ * unrolledListDot                                                            *
+ ******************************************************************************
+ * description: computes the dot product of two unrolled lists. The nodes of  *
+ *              the lists may hold a different number of values, so the      *
+ *              kernel is called for each run that is contiguous in both.     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *first  : receives the first list address.             *
+ *      unrolledList_t *second : receives the second list address.            *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                   : dot product (0 if a list is empty).          *
+ ******************************************************************************/
+real unrolledListDot(const unrolledList_t *first, const unrolledList_t *second)
+{
+    const linkedListReduceKernels_t *kernels = linkedListReduceKernels();
+    const unrolledListNode_t *a = first->head, *b = second->head;
+    natural i = 0, j = 0, run;
+    real sum = 0;
+
+    while(a != NULL && b != NULL)
+    {
+        run = a->count - i;
+        if (b->count - j < run) run = b->count - j;
+
+        sum += kernels->dot(a->data + i, b->data + j, run);
+        i += run;
+        j += run;
+
+        if (i == a->count) { a = a->next; i = 0; }
+        if (j == b->count) { b = b->next; j = 0; }
+    }
+
+    return sum;
+}
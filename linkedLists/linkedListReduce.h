@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                       LINKED LIST BULK REDUCTIONS                          *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * Whole-list reductions: sum, minimum, maximum, mean, variance, count-if and *
+ * the dot product of two lists. The nodes of a linkedList_t are gathered     *
+ * into contiguous blocks, which are reduced by SIMD kernels (AVX2 or SSE2,   *
+ * chosen at runtime, with a scalar fallback). The unrolled list already      *
+ * keeps its values contiguous, so its blocks are reduced in place.           *
+ *                                                                            *
+ * Tolerances, with respect to the scalar (left to right) reference:          *
+ *                                                                            *
+ *  - min and max are exact. NaN values are not supported.                    *
+ *  - sum, mean and dot are computed in a different order (one partial sum    *
+ *    per SIMD lane), so they may differ by up to n * DBL_EPSILON * S, where  *
+ *    S is the sum of the absolute values of the terms.                       *
+ *  - variance is the population variance, computed in two passes (mean, then *
+ *    squared deviations), with the same bound applied to the deviations.     *
+ *                                                                            *
+ * Reductions over an empty list give 0, except min and max, which print an   *
+ * error and give -1, as linkedListGet does.                                  *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_REDUCE_H__
+#define __LINKED_LIST_REDUCE_H__
+
+#include "linkedList.h"
+#include "unrolledList.h"
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef enum linkedListReduceIsa
+{
+    LINKED_LIST_REDUCE_AUTO = 0,
+    LINKED_LIST_REDUCE_SCALAR,
+    LINKED_LIST_REDUCE_SSE2,
+    LINKED_LIST_REDUCE_AVX2
+
+} linkedListReduceIsa_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+linkedListReduceIsa_t linkedListReduceSelect(linkedListReduceIsa_t isa);
+const char *linkedListReduceName(void);
+
+real linkedListSum(const linkedList_t *list);
+real linkedListMin(const linkedList_t *list);
+real linkedListMax(const linkedList_t *list);
+real linkedListMean(const linkedList_t *list);
+real linkedListVariance(const linkedList_t *list);
+natural linkedListCountIf(const linkedList_t *list, 
+                          linkedListPredicate_t predicate, void *context);
+real linkedListDot(const linkedList_t *first, const linkedList_t *second);
+
+real unrolledListSum(const unrolledList_t *list);
+real unrolledListMin(const unrolledList_t *list);
+real unrolledListMax(const unrolledList_t *list);
+real unrolledListMean(const unrolledList_t *list);
+real unrolledListVariance(const unrolledList_t *list);
+natural unrolledListCountIf(const unrolledList_t *list, 
+                            linkedListPredicate_t predicate, void *context);
+real unrolledListDot(const unrolledList_t *first, 
+                     const unrolledList_t *second);
+
+#endif
+/*****END*****/
@@ -0,0 +1,243 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                   LINKED LIST REDUCTIONS CHECK, PER ISA                    *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListReduceCheck [seed] [largest size]                         *
+ *                                                                            *
+ * For every list size from 0 to the largest one, so that every tail that is  *
+ * not a multiple of the SIMD lanes (and of the gathered blocks) comes up,    *
+ * the reductions of a linkedList_t and of an unrolledList_t are computed     *
+ * with the scalar kernels, the reference, and then with every other kernel   *
+ * set linkedListReduceSelect accepts on this machine (SSE2, AVX2). They must *
+ * agree within the tolerances of linkedListReduce.h:                         *
+ *                                                                            *
+ *  - min, max and count-if exactly;                                          *
+ *  - sum and dot within n * DBL_EPSILON * S, S the sum of |term|;            *
+ *  - mean within that bound over n, and variance within the same bound on    *
+ *    the squared deviations, over n.                                         *
+ *                                                                            *
+ * The exit code is 1 on the first difference, which is written to stderr.   *
+ * The error messages of the lists (min and max of an empty list) go to       *
+ * stdout, which is sent to /dev/null.                                        *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "unrolledList.h"
+#include "linkedListReduce.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+/*Sizes above the gathered block of linkedListReduce.c (256 values)*/
+#define REDUCE_CHECK_SIZE 600
+
+typedef struct reduceResult
+{
+    real    sum;
+    real    min;
+    real    max;
+    real    mean;
+    real    variance;
+    real    dot;
+    natural count;
+
+} reduceResult_t;
+
+/*The tolerances: the sums of |term| of the sum, the deviations and the dot*/
+typedef struct reduceBound
+{
+    real sum;
+    real deviation;
+    real dot;
+
+} reduceBound_t;
+
+static int reduceAbove(real data, void *context)
+{
+    return data > *(const real*) context;
+}
+
+static void reduceLinked(reduceResult_t *result, const linkedList_t *first,
+                         const linkedList_t *second, real threshold)
+{
+    result->sum      = linkedListSum(first);
+    result->min      = linkedListMin(first);
+    result->max      = linkedListMax(first);
+    result->mean     = linkedListMean(first);
+    result->variance = linkedListVariance(first);
+    result->dot      = linkedListDot(first, second);
+    result->count    = linkedListCountIf(first, reduceAbove, &threshold);
+}
+
+static void reduceUnrolled(reduceResult_t *result, const unrolledList_t *first,
+                           const unrolledList_t *second, real threshold)
+{
+    result->sum      = unrolledListSum(first);
+    result->min      = unrolledListMin(first);
+    result->max      = unrolledListMax(first);
+    result->mean     = unrolledListMean(first);
+    result->variance = unrolledListVariance(first);
+    result->dot      = unrolledListDot(first, second);
+    result->count    = unrolledListCountIf(first, reduceAbove, &threshold);
+}
+
+static const char *reduceWhere = "";
+
+static int reduceClose(const char *what, real value, real reference,
+                       real bound)
+{
+    if (fabs(value - reference) <= bound) return 1;
+
+    fprintf(stderr, "%s %s: %.17g, scalar %.17g, bound %.3g\n", reduceWhere,
+            what, value, reference, bound);
+    return 0;
+}
+
+static int reduceCompare(const char *where, const reduceResult_t *result,
+                         const reduceResult_t *reference,
+                         const reduceBound_t *bound, natural size)
+{
+    real n = (real) size, ulps = (n + 1) * DBL_EPSILON;
+    int passed = 1;
+
+    reduceWhere = where;
+    passed &= reduceClose("sum", result->sum, reference->sum,
+                          ulps * bound->sum);
+    passed &= reduceClose("min", result->min, reference->min, 0);
+    passed &= reduceClose("max", result->max, reference->max, 0);
+    passed &= reduceClose("mean", result->mean, reference->mean,
+                          size ? ulps * bound->sum / n : 0);
+    passed &= reduceClose("variance", result->variance, reference->variance,
+                          size ? ulps * bound->deviation / n : 0);
+    passed &= reduceClose("dot", result->dot, reference->dot,
+                          ulps * bound->dot);
+    passed &= reduceClose("count-if", (real) result->count,
+                          (real) reference->count, 0);
+
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    static const linkedListReduceIsa_t isas[] =
+    {
+        LINKED_LIST_REDUCE_SSE2, LINKED_LIST_REDUCE_AVX2
+    };
+    static const char *isaNames[] = { "SSE2", "AVX2" };
+    unsigned long long seed = 1, state;
+    natural largest = REDUCE_CHECK_SIZE, size, checked = 0;
+    real *first, *second, threshold, mean;
+    reduceResult_t linkedReference, unrolledReference, result;
+    char where[64];
+    reduceBound_t bound;
+    int passed = 1;
+    register natural i, k;
+
+    /*the lists report their edge cases on stdout*/
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+
+    if (argc > 1) seed    = strtoull(argv[1], NULL, 10);
+    if (argc > 2) largest = (natural) strtoul(argv[2], NULL, 10);
+
+    first  = (real*) malloc((largest + 1) * sizeof(real));
+    second = (real*) malloc((largest + 1) * sizeof(real));
+    if (first == NULL || second == NULL)
+    {
+        fprintf(stderr, "ERROR::out of memory\n");
+        return 1;
+    }
+
+    state = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    for(size = 0; size <= largest && passed; size++)
+    {
+        linkedList_t *linkedFirst = NULL, *linkedSecond = NULL;
+        unrolledList_t unrolledFirst, unrolledSecond;
+
+        /*xorshift64 values of mixed signs and magnitudes, so that the order
+          of the additions matters*/
+        for(i = 0; i < size; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            first[i]  = ((real) (state >> 11) / 9007199254740992.0 - 0.5) *
+                        ldexp(1.0, (int) (state & 31) - 8);
+            second[i] = ((real) (state & 0xFFFFF) / 1048576.0 - 0.5);
+        }
+
+        bound.sum = bound.deviation = bound.dot = 0;
+        for(i = 0; i < size; i++)
+        {
+            bound.sum += fabs(first[i]);
+            bound.dot += fabs(first[i] * second[i]);
+        }
+        mean = 0;
+        for(i = 0; i < size; i++) mean += first[i];
+        mean = size ? mean / size : 0;
+        for(i = 0; i < size; i++)
+        {
+            bound.deviation += (first[i] - mean) * (first[i] - mean);
+        }
+        threshold = size ? first[size / 2] : 0;
+
+        linkedFirst  = linkedListFromArray(first, size);
+        linkedSecond = linkedListFromArray(second, size);
+        unrolledListInit(&unrolledFirst);
+        unrolledListInit(&unrolledSecond);
+        for(i = 0; i < size; i++)
+        {
+            unrolledListAddEnd(&unrolledFirst, first[i]);
+            unrolledListAddEnd(&unrolledSecond, second[i]);
+        }
+
+        linkedListReduceSelect(LINKED_LIST_REDUCE_SCALAR);
+        reduceLinked(&linkedReference, linkedFirst, linkedSecond, threshold);
+        reduceUnrolled(&unrolledReference, &unrolledFirst, &unrolledSecond,
+                       threshold);
+
+        for(k = 0; k < sizeof(isas) / sizeof(isas[0]) && passed; k++)
+        {
+            /*an ISA the machine lacks falls back to a narrower one*/
+            if (linkedListReduceSelect(isas[k]) != isas[k]) continue;
+
+            snprintf(where, sizeof(where), "%s linkedList size %d",
+                     isaNames[k], size);
+            reduceLinked(&result, linkedFirst, linkedSecond, threshold);
+            passed &= reduceCompare(where, &result, &linkedReference,
+                                    &bound, size);
+
+            snprintf(where, sizeof(where), "%s unrolledList size %d",
+                     isaNames[k], size);
+            reduceUnrolled(&result, &unrolledFirst, &unrolledSecond,
+                           threshold);
+            passed &= reduceCompare(where, &result, &unrolledReference,
+                                    &bound, size);
+            checked++;
+        }
+
+        linkedListFree(linkedFirst);
+        linkedListFree(linkedSecond);
+        unrolledListFree(&unrolledFirst);
+        unrolledListFree(&unrolledSecond);
+    }
+
+    free(first);
+    free(second);
+
+    if (!passed) return 1;
+
+    fprintf(stderr, "linkedListReduceCheck::[ seed %llu sizes 0..%d "
+            "checks %d ]\n", seed, largest, checked);
+
+    return 0;
+}
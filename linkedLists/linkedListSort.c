@@ -0,0 +1,258 @@
+/******************************************************************************
+ *                          LINKED LIST SORTING                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListSort.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*A bin holds a sorted run of 2^i nodes: 64 bins are enough for any list*/
+#define SORT_BINS 64
+/*Lists shorter than this are not worth the threads*/
+#define SORT_PARALLEL_THRESHOLD 32768
+/*Every run of the parallel sort has at least this many nodes*/
+#define SORT_MIN_RUN 4096
+
+/*Merges two sorted chains. On ties, the node of first comes first, which 
+  keeps the sort stable.*/
+static linkedList_t *linkedListMerge(linkedList_t *first, linkedList_t *second)
+{
+    linkedList_t head;
+    linkedList_t *tail = &head;
+
+    while(first != NULL && second != NULL)
+    {
+        if (second->data < first->data)
+        {
+            tail->next = second;
+            second = second->next;
+        }
+        else
+        {
+            tail->next = first;
+            first = first->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (first != NULL) ? first : second;
+
+    return head.next;
+}
+
+typedef struct sortTask
+{
+    linkedList_t *first;
+    linkedList_t *second;
+    linkedList_t *result;
+
+} sortTask_t;
+
+static void sortRunTask(void *argument)
+{
+    sortTask_t *task = (sortTask_t*) argument;
+
+    task->result = task->first;
+    linkedListSort(&task->result);
+}
+
+static void sortMergeTask(void *argument)
+{
+    sortTask_t *task = (sortTask_t*) argument;
+
+    task->result = linkedListMerge(task->first, task->second);
+}
+
+/******************************************************************************
+ * linkedListSort                                                             *
+ ******************************************************************************
+ * description: sorts the list in ascending order, relinking its nodes. Each  *
+ *              node is merged into the bins of sorted runs: a full bin i is  *
+ *              merged with the carried run and emptied, and the result is   *
+ *              carried to the bin i+1. At the end, the bins are merged from  *
+ *              the smallest to the largest.                                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t **list  : receives the list head address (e.g, &list).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                 : the sorted list.                               *
+ ******************************************************************************/
+void linkedListSort(linkedList_t **list)
+{
+    linkedList_t *bins[SORT_BINS] = { NULL };
+    linkedList_t *current = *list;
+    linkedList_t *carry, *result = NULL;
+    natural used = 0;
+    register natural i;
+
+    while(current != NULL)
+    {
+        carry = current;
+        current = current->next;
+        carry->next = NULL;
+
+        /*the bins hold older nodes than the carry, so they go first*/
+        for(i = 0; bins[i] != NULL; i++)
+        {
+            carry = linkedListMerge(bins[i], carry);
+            bins[i] = NULL;
+        }
+        bins[i] = carry;
+        if (i + 1 > used) used = i + 1;
+    }
+
+    /*the larger bins hold the older nodes*/
+    for(i = 0; i < used; i++)
+    {
+        if (bins[i] != NULL) result = linkedListMerge(bins[i], result);
+    }
+
+    *list = result;
+}
+
+/******************************************************************************
+ * linkedListSortParallel                                                     *
+ ******************************************************************************
+ * description: sorts the list in ascending order on the workers of a thread  *
+ *              pool. The list is cut into runs (four per worker), the runs   *
+ *              are sorted, and then merged in pairs round after round.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedList_t **list  : receives the list head address (e.g, &list).   *
+ *      threadPool_t  *pool  : workers (NULL sorts serially).                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                 : the sorted list.                               *
+ ******************************************************************************/
+void linkedListSortParallel(linkedList_t **list, threadPool_t *pool)
+{
+    linkedList_t *current = *list;
+    threadPoolGroup_t group;
+    natural size = 0, runs, length;
+    register natural i, j;
+
+    while(current != NULL)
+    {
+        size++;
+        current = current->next;
+    }
+
+    if (pool == NULL || threadPoolSize(pool) < 2 || 
+        size < SORT_PARALLEL_THRESHOLD)
+    {
+        linkedListSort(list);
+        return ;
+    }
+
+    runs = 4 * threadPoolSize(pool);
+    if (runs > size / SORT_MIN_RUN) runs = size / SORT_MIN_RUN;
+    length = size / runs;
+
+    sortTask_t *tasks = (sortTask_t*) malloc(runs * sizeof(sortTask_t));
+    if (tasks == NULL)
+    {
+        printf("ERROR::out of memory, sorting serially\n");
+        linkedListSort(list);
+        return ;
+    }
+
+    /*cutting the list into runs; the last one takes the remainder*/
+    current = *list;
+    for(i = 0; i < runs; i++)
+    {
+        tasks[i].first = current;
+        if (i == runs - 1) break;
+
+        for(j = 1; j < length; j++) current = current->next;
+        linkedList_t *nextRun = current->next;
+        current->next = NULL;
+        current = nextRun;
+    }
+
+    /*a group of its own: the sort may run inside a task, or share the pool*/
+    threadPoolGroupInit(&group, pool);
+    for(i = 0; i < runs; i++)
+    {
+        threadPoolGroupSubmit(&group, sortRunTask, &tasks[i]);
+    }
+    threadPoolGroupWait(&group);
+
+    /*merging neighbour runs in pairs, until there is one run*/
+    while(runs > 1)
+    {
+        natural pairs = runs / 2;
+
+        for(i = 0; i < pairs; i++)
+        {
+            tasks[i].first  = tasks[2*i].result;
+            tasks[i].second = tasks[2*i+1].result;
+        }
+        for(i = 0; i < pairs; i++) 
+        {
+            threadPoolGroupSubmit(&group, sortMergeTask, &tasks[i]);
+        }
+        threadPoolGroupWait(&group);
+
+        /*an odd run is carried to the next round*/
+        if (runs % 2 == 1) tasks[pairs].result = tasks[runs-1].result;
+        runs = pairs + runs % 2;
+    }
+
+    *list = tasks[0].result;
+    free(tasks);
+}
+
+/*Finds the new tail and forgets the last position of a sorted handle*/
+static void linkedListHandleSorted(linkedListHandle_t *handle)
+{
+    linkedList_t *tail = handle->head;
+
+    while(tail != NULL && tail->next != NULL) tail = tail->next;
+
+    handle->tail     = tail;
+    handle->lastNode = NULL;
+}
+
+/******************************************************************************
+ * linkedListHandleSort                                                       *
+ ******************************************************************************
+ * description: sorts the list of a handle in ascending order.                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the sorted list.                         *
+ ******************************************************************************/
+void linkedListHandleSort(linkedListHandle_t *handle)
+{
+    linkedListSort(&handle->head);
+    linkedListHandleSorted(handle);
+}
+
+/******************************************************************************
+ * linkedListHandleSortParallel                                               *
+ ******************************************************************************
+ * description: sorts the list of a handle in ascending order on the workers  *
+ *              of a thread pool.                                             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListHandle_t *handle : receives the handle address (&handle).   *
+ *      threadPool_t       *pool   : workers (NULL sorts serially).           *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the sorted list.                         *
+ ******************************************************************************/
+void linkedListHandleSortParallel(linkedListHandle_t *handle, 
+                                  threadPool_t *pool)
+{
+    linkedListSortParallel(&handle->head, pool);
+    linkedListHandleSorted(handle);
+}
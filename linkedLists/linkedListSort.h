@@ -0,0 +1,41 @@
+/******************************************************************************
+ *                          LINKED LIST SORTING                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * Sorts a linked list in ascending order of data by relinking its nodes: no  *
+ * node is allocated, copied or freed. The sort is a bottom-up merge sort,    *
+ * stable and O(n log n), which keeps sorted runs of 1, 2, 4, ... nodes in an *
+ * array of bins and merges each new node into them.                          *
+ *                                                                            *
+ * The parallel sort cuts the list into runs, sorts the runs on the workers   *
+ * of a thread pool and merges them in pairs, also on the pool, until a       *
+ * single run is left. Runs are always merged with their right neighbour, so  *
+ * the parallel sort is stable as well. Short lists are sorted serially.      *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_SORT_H__
+#define __LINKED_LIST_SORT_H__
+
+#include "linkedList.h"
+#include "threadPool.h"
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void linkedListSort(linkedList_t **list);
+void linkedListSortParallel(linkedList_t **list, threadPool_t *pool);
+void linkedListHandleSort(linkedListHandle_t *handle);
+void linkedListHandleSortParallel(linkedListHandle_t *handle, 
+                                  threadPool_t *pool);
+
+#endif
+/*****END*****/
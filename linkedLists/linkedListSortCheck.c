@@ -0,0 +1,240 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                         LINKED LIST SORT CHECK                             *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListSortCheck [seed] [threads]                                *
+ *                                                                            *
+ * Lists of many equal keys (and of sorted, reversed and constant ones) are   *
+ * sorted serially, by linkedListSortParallel without and with a pool of      *
+ * workers, through a handle, and from inside a pool task. The nodes come     *
+ * from one array, so a node tells its position before the sort: the order    *
+ * of the nodes must be the one of a stable sort of the keys, i.e. equal keys *
+ * keep their order. The sizes go past the parallel threshold (32768).        *
+ *                                                                            *
+ * The exit code is 1 on the first difference, which is written to stderr.    *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "linkedListSort.h"
+#include "threadPool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum sortCheckMode
+{
+    SORT_CHECK_SERIAL = 0,
+    SORT_CHECK_NO_POOL,
+    SORT_CHECK_POOL,
+    SORT_CHECK_HANDLE,
+    SORT_CHECK_IN_TASK,
+    SORT_CHECK_MODES
+
+} sortCheckMode_t;
+
+static const char *sortCheckModes[] =
+{
+    "serial", "parallel without pool", "parallel", "handle", "in a task"
+};
+
+typedef enum sortCheckKeys
+{
+    SORT_CHECK_FEW = 0,       /*random keys, many of them equal*/
+    SORT_CHECK_SORTED,
+    SORT_CHECK_REVERSED,
+    SORT_CHECK_EQUAL,
+    SORT_CHECK_KEYS
+
+} sortCheckKeys_t;
+
+static const char *sortCheckKeysNames[] =
+{
+    "few keys", "sorted", "reversed", "equal"
+};
+
+typedef struct sortCheckTask
+{
+    linkedList_t **list;
+    threadPool_t  *pool;
+
+} sortCheckTask_t;
+
+/*The keys of the stable reference sort, ties broken by position*/
+static const real *sortCheckKeysOf;
+
+static int sortCheckCompare(const void *a, const void *b)
+{
+    natural first = *(const natural*) a, second = *(const natural*) b;
+    real x = sortCheckKeysOf[first], y = sortCheckKeysOf[second];
+
+    if (x < y) return -1;
+    if (y < x) return 1;
+
+    return (first > second) - (first < second);
+}
+
+static void sortCheckTaskRun(void *argument)
+{
+    sortCheckTask_t *task = (sortCheckTask_t*) argument;
+    linkedListSortParallel(task->list, task->pool);
+}
+
+static int sortCheckOne(linkedList_t *nodes, const real *keys, natural *order,
+                        natural size, sortCheckMode_t mode,
+                        threadPool_t *pool)
+{
+    linkedList_t *list = size > 0 ? nodes : NULL, *current, *last = NULL;
+    linkedListHandle_t handle;
+    threadPoolGroup_t group;
+    sortCheckTask_t task = { &list, pool };
+    natural i;
+
+    for(i = 0; i < size; i++)
+    {
+        nodes[i].data = keys[i];
+        nodes[i].next = (i + 1 < size) ? &nodes[i + 1] : NULL;
+    }
+
+    switch(mode)
+    {
+        case SORT_CHECK_SERIAL:  linkedListSort(&list);                break;
+        case SORT_CHECK_NO_POOL: linkedListSortParallel(&list, NULL);  break;
+        case SORT_CHECK_POOL:    linkedListSortParallel(&list, pool);  break;
+        case SORT_CHECK_HANDLE:
+            /*the nodes are the handle's, only to be sorted*/
+            linkedListHandleInit(&handle);
+            handle.head = list;
+            handle.tail = size > 0 ? &nodes[size - 1] : NULL;
+            handle.size = size;
+            linkedListHandleSortParallel(&handle, pool);
+            list = handle.head;
+            break;
+        case SORT_CHECK_IN_TASK:
+            threadPoolGroupInit(&group, pool);
+            threadPoolGroupSubmit(&group, sortCheckTaskRun, &task);
+            threadPoolGroupWait(&group);
+            break;
+        default: break;
+    }
+
+    for(i = 0; i < size; i++) order[i] = i;
+    sortCheckKeysOf = keys;
+    qsort(order, size, sizeof(natural), sortCheckCompare);
+
+    for(i = 0, current = list; i < size; i++, current = current->next)
+    {
+        if (current == NULL || current != &nodes[order[i]])
+        {
+            fprintf(stderr, "linkedListSortCheck::position %d holds node %d "
+                    "instead of %d\n", i,
+                    current == NULL ? -1 : (int) (current - nodes), order[i]);
+            return 0;
+        }
+        last = current;
+    }
+    if (current != NULL)
+    {
+        fprintf(stderr, "linkedListSortCheck::the list is longer\n");
+        return 0;
+    }
+    if (mode == SORT_CHECK_HANDLE && handle.tail != last)
+    {
+        fprintf(stderr, "linkedListSortCheck::the handle tail is stale\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static const natural sizes[] =
+    {
+        0, 1, 2, 3, 17, 1000, 32767, 32768, 100003
+    };
+    unsigned long long seed = 1, state;
+    natural threads = 4, largest = 0, size, checks = 0;
+    linkedList_t *nodes;
+    threadPool_t pool;
+    real *keys;
+    natural *order;
+    natural s, k, m, i;
+    int passed = 1;
+
+    if (argc > 1) seed    = strtoull(argv[1], NULL, 10);
+    if (argc > 2) threads = (natural) strtoul(argv[2], NULL, 10);
+    if (threads < 2) threads = 2;
+    state = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        if (sizes[s] > largest) largest = sizes[s];
+    }
+    nodes = (linkedList_t*) malloc(largest * sizeof(linkedList_t));
+    keys  = (real*) malloc(largest * sizeof(real));
+    order = (natural*) malloc(largest * sizeof(natural));
+    if (nodes == NULL || keys == NULL || order == NULL)
+    {
+        fprintf(stderr, "ERROR::out of memory\n");
+        return 1;
+    }
+
+    threadPoolInit(&pool, threads);
+
+    for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && passed; s++)
+    {
+        size = sizes[s];
+        for(k = 0; k < SORT_CHECK_KEYS && passed; k++)
+        {
+            for(i = 0; i < size; i++)
+            {
+                /*xorshift64 keys, with -0.0 and 0.0 as one more tie*/
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                switch(k)
+                {
+                    case SORT_CHECK_FEW:
+                        keys[i] = (real) (state % 64) - 32;
+                        if (keys[i] == 0 && (state & 64)) keys[i] = -0.0;
+                        break;
+                    case SORT_CHECK_SORTED:   keys[i] = (real) (i / 3);  break;
+                    case SORT_CHECK_REVERSED: keys[i] = (real) (size - i);
+                                              break;
+                    default:                  keys[i] = 1.5;             break;
+                }
+            }
+
+            for(m = 0; m < SORT_CHECK_MODES && passed; m++)
+            {
+                passed = sortCheckOne(nodes, keys, order, size,
+                                      (sortCheckMode_t) m, &pool);
+                if (!passed)
+                {
+                    fprintf(stderr, "linkedListSortCheck::%s, %s, size %d\n",
+                            sortCheckModes[m], sortCheckKeysNames[k], size);
+                }
+                checks++;
+            }
+        }
+    }
+
+    threadPoolDestroy(&pool);
+    free(nodes);
+    free(keys);
+    free(order);
+
+    if (!passed) return 1;
+
+    fprintf(stderr, "linkedListSortCheck::[ seed %llu threads %d checks %d "
+            "]\n", seed, threads, checks);
+
+    return 0;
+}
@@ -0,0 +1,649 @@
+/******************************************************************************
+ *                         BUFFERED LIST WRITER                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "linkedListWriter.h"
+#include "linkedListWriterPowers.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*Longest text of a double: 309 integral digits, the point and the decimals*/
+#define WRITER_MAX_PRECISION 40
+#define WRITER_MAX_REAL      (320 + WRITER_MAX_PRECISION)
+
+/*Bounds of the FIXED fast path (see linkedListWriterFixed)*/
+#define WRITER_MAX_SCALED    1099511627776.0
+#define WRITER_TIE           (1.0 / 1024)
+
+static int linkedListFdWrite(void *context, const void *bytes, size_t size)
+{
+    const char *from = (const char*) bytes;
+    int fd = *(const int*) context;
+
+    while(size > 0)
+    {
+        ssize_t written = write(fd, from, size);
+        if (written < 0)
+        {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        from += written;
+        size -= (size_t) written;
+    }
+
+    return 1;
+}
+
+static int linkedListFileWrite(void *context, const void *bytes, size_t size)
+{
+    return fwrite(bytes, 1, size, (FILE*) context) == size;
+}
+
+static int linkedListMemoryWrite(void *context, const void *bytes, size_t size)
+{
+    linkedListMemorySink_t *memory = (linkedListMemorySink_t*) context;
+    size_t room = memory->capacity - memory->size;
+
+    /*what fits is kept, but the output is reported as truncated*/
+    if (size > room)
+    {
+        memcpy(memory->data + memory->size, bytes, room);
+        memory->size += room;
+        return 0;
+    }
+
+    memcpy(memory->data + memory->size, bytes, size);
+    memory->size += size;
+
+    return 1;
+}
+
+/*Makes room for size more bytes in the buffer*/
+static char *linkedListWriterReserve(linkedListWriter_t *writer, size_t size)
+{
+    if (writer->used + size > LINKED_LIST_WRITER_BUFFER)
+    {
+        linkedListWriterFlush(writer);
+    }
+
+    return writer->buffer + writer->used;
+}
+
+/*Writes at least minimum digits of an integer, and returns their number*/
+static size_t linkedListWriterDigits(char *text, unsigned long long integer,
+                                     natural minimum)
+{
+    char digits[24];
+    size_t count = 0, length = 0;
+
+    do
+    {
+        digits[count++] = (char) ('0' + integer % 10);
+        integer /= 10;
+    }
+    while(integer > 0 || count < minimum);
+
+    while(count > 0) text[length++] = digits[--count];
+
+    return length;
+}
+
+static size_t linkedListWriterFixed(char *text, real value, natural precision)
+{
+    static const real powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8};
+    unsigned long long integer;
+    real scaled, fraction;
+    size_t length = 0, digits;
+
+    if (precision > 8 || !isfinite(value))
+    {
+        return (size_t) snprintf(text, WRITER_MAX_REAL, "%.*f",
+                                 (int) precision, value);
+    }
+
+    /*
+     * Below 2^40 the product is off the exact one by less than 2^-13, so it
+     * rounds to the same integer as printf does, unless it is close to a tie.
+     */
+    scaled   = fabs(value) * powers[precision];
+    integer  = (unsigned long long) scaled;
+    fraction = scaled - (real) integer;
+    if (scaled >= WRITER_MAX_SCALED || fabs(fraction - 0.5) < WRITER_TIE)
+    {
+        return (size_t) snprintf(text, WRITER_MAX_REAL, "%.*f",
+                                 (int) precision, value);
+    }
+    if (fraction > 0.5) integer++;
+
+    /*printf keeps the sign of -0.0, and of what rounds to it*/
+    if (signbit(value)) text[length++] = '-';
+
+    digits = linkedListWriterDigits(text + length, integer, precision + 1);
+    if (precision > 0)
+    {
+        memmove(text + length + digits - precision + 1,
+                text + length + digits - precision, precision);
+        text[length + digits - precision] = '.';
+        length++;
+    }
+
+    return length + digits;
+}
+
+/*The 128-bit product of two 64-bit words*/
+static unsigned long long writerMultiply(unsigned long long a,
+                                         unsigned long long b,
+                                         unsigned long long *high)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128) a * b;
+
+    *high = (unsigned long long) (product >> 64);
+    return (unsigned long long) product;
+#else
+    unsigned long long aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+    unsigned long long bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+    unsigned long long low = aLow * bLow, middle = aHigh * bLow;
+    unsigned long long cross = (low >> 32) + (middle & 0xFFFFFFFFULL)
+                               + aLow * bHigh;
+
+    *high = aHigh * bHigh + (middle >> 32) + (cross >> 32);
+    return (cross << 32) | (low & 0xFFFFFFFFULL);
+#endif
+}
+
+/*(m * power) >> shift, with power a {low, high} pair and shift above 64*/
+static unsigned long long writerScale(unsigned long long m,
+                                      const unsigned long long power[2],
+                                      int shift)
+{
+    unsigned long long lowHigh, high, highHigh, middle;
+
+    writerMultiply(m, power[0], &lowHigh);
+    middle = writerMultiply(m, power[1], &highHigh);
+    high   = middle + lowHigh;
+    if (high < middle) highHigh++;
+
+    shift -= 64;
+    return (shift == 0) ? highHigh
+                        : (highHigh << (64 - shift)) | (high >> shift);
+}
+
+/*Bits of 5^e, and floor(log10(2^e)) and floor(log10(5^e)), for small e*/
+static int writerPow5Bits(int e)   { return (int) ((e * 1217359U) >> 19) + 1; }
+static int writerLog10Pow2(int e)  { return (int) ((e * 78913U) >> 18); }
+static int writerLog10Pow5(int e)  { return (int) ((e * 732923U) >> 20); }
+
+static int writerMultipleOfPow5(unsigned long long value, int power)
+{
+    int count = 0;
+
+    while(value % 5 == 0 && count < power)
+    {
+        value /= 5;
+        count++;
+    }
+
+    return count >= power;
+}
+
+/*
+ * The shortest digits of a positive finite double, after Ryu (Adams, 2018):
+ * the double and the halfway points to its neighbours are scaled by one
+ * power of ten, with 125-bit powers of five, so the digits of the interval
+ * that reads back to the double are known exactly. Digits are then dropped
+ * while both ends of the interval still differ, and the last one is rounded
+ * to the nearest, ties to even. Returns the digits and their exponent.
+ */
+static unsigned long long writerShortestDigits(unsigned long long bits,
+                                               int *exponent)
+{
+    unsigned long long mantissa = bits & ((1ULL << 52) - 1);
+    int biased = (int) ((bits >> 52) & 0x7FF);
+    unsigned long long m2, mv, vr, vp, vm, output;
+    int e2, e10, q, k, i, removed = 0, mmShift, acceptBounds;
+    int vmIsTrailingZeros = 0, vrIsTrailingZeros = 0, roundUp = 0;
+    int lastRemovedDigit = 0;
+
+    if (biased == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = mantissa;
+    }
+    else
+    {
+        e2 = biased - 1023 - 52 - 2;
+        m2 = (1ULL << 52) | mantissa;
+    }
+    acceptBounds = (m2 & 1) == 0;
+
+    /*the interval is [mv - 1 - mmShift, mv + 2] in units of 2^e2 / 4*/
+    mv      = 4 * m2;
+    mmShift = mantissa != 0 || biased <= 1;
+
+    if (e2 >= 0)
+    {
+        q   = writerLog10Pow2(e2) - (e2 > 3);
+        e10 = q;
+        k   = 125 + writerPow5Bits(q) - 1;
+        i   = -e2 + q + k;
+        vr  = writerScale(mv, writerPow5Inverse[q], i);
+        vp  = writerScale(mv + 2, writerPow5Inverse[q], i);
+        vm  = writerScale(mv - 1 - mmShift, writerPow5Inverse[q], i);
+
+        /*the digits dropped are all zeros only if 5^q divides the value*/
+        if (q <= 21)
+        {
+            if (mv % 5 == 0)
+            {
+                vrIsTrailingZeros = writerMultipleOfPow5(mv, q);
+            }
+            else if (acceptBounds)
+            {
+                vmIsTrailingZeros = writerMultipleOfPow5(mv - 1 - mmShift, q);
+            }
+            else
+            {
+                vp -= writerMultipleOfPow5(mv + 2, q);
+            }
+        }
+    }
+    else
+    {
+        q   = writerLog10Pow5(-e2) - (-e2 > 1);
+        e10 = q + e2;
+        i   = -e2 - q;
+        k   = writerPow5Bits(i) - 125;
+        vr  = writerScale(mv, writerPow5[i], q - k);
+        vp  = writerScale(mv + 2, writerPow5[i], q - k);
+        vm  = writerScale(mv - 1 - mmShift, writerPow5[i], q - k);
+
+        /*and here only if 2^q divides it*/
+        if (q <= 1)
+        {
+            vrIsTrailingZeros = 1;
+            if (acceptBounds) vmIsTrailingZeros = mmShift;
+            else              vp--;
+        }
+        else if (q < 63)
+        {
+            vrIsTrailingZeros = (mv & ((1ULL << q) - 1)) == 0;
+        }
+    }
+
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        /*the rare exact case: the dropped digits decide the rounding*/
+        while(vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (int) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros)
+        {
+            while(vm % 10 == 0)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (int) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+        {
+            lastRemovedDigit = 4;
+        }
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) ||
+                       lastRemovedDigit >= 5);
+    }
+    else
+    {
+        while(vp / 10 > vm / 10)
+        {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || roundUp);
+    }
+
+    *exponent = e10 + removed;
+    return output;
+}
+
+/*
+ * The shortest digits laid out as printf("%.17g") lays them out: plainly
+ * from 1e-5 to below 1e17, so integers have no decimal point, and with an
+ * exponent of at least two digits otherwise (e.g. 1e+17, 5e-324).
+ */
+static size_t linkedListWriterShortest(char *text, real value)
+{
+    unsigned long long bits, digits;
+    int exponent, point;
+    size_t length = 0, count;
+
+    memcpy(&bits, &value, sizeof(real));
+    if (bits >> 63) text[length++] = '-';
+    bits &= ~(1ULL << 63);
+
+    if (bits >= 0x7FF0000000000000ULL)
+    {
+        memcpy(text + length, bits > 0x7FF0000000000000ULL ? "nan" : "inf", 3);
+        return length + 3;
+    }
+    if (bits == 0)
+    {
+        text[length] = '0';
+        return length + 1;
+    }
+
+    digits = writerShortestDigits(bits, &exponent);
+    count  = linkedListWriterDigits(text + length, digits, 1);
+    point  = exponent + (int) count;         /*digits before the point*/
+
+    if (point > 17 || point < -3)
+    {
+        /*d.ddd, then e and the sign and digits of the exponent*/
+        if (count > 1)
+        {
+            memmove(text + length + 2, text + length + 1, count - 1);
+            text[length + 1] = '.';
+            length++;
+        }
+        length += count;
+        text[length++] = 'e';
+        text[length++] = (point - 1 < 0) ? '-' : '+';
+        length += linkedListWriterDigits(text + length,
+                                         (unsigned long long) abs(point - 1),
+                                         2);
+    }
+    else if (point >= (int) count)
+    {
+        memset(text + length + count, '0', (size_t) point - count);
+        length += (size_t) point;
+    }
+    else if (point > 0)
+    {
+        memmove(text + length + point + 1, text + length + point,
+                count - (size_t) point);
+        text[length + point] = '.';
+        length += count + 1;
+    }
+    else
+    {
+        memmove(text + length + 2 - point, text + length, count);
+        text[length]     = '0';
+        text[length + 1] = '.';
+        memset(text + length + 2, '0', (size_t) -point);
+        length += count + 2 - (size_t) point;
+    }
+
+    return length;
+}
+
+/******************************************************************************
+ * linkedListWriterInit                                                       *
+ ******************************************************************************
+ * description: initializes a writer on any sink, given by its write          *
+ *              function. Values are written as linkedListTransverse prints   *
+ *              them, until another format is chosen.                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t   *writer  : receives the writer address (&writer).*
+ *      linkedListSinkWrite_t write   : writes bytes into the sink.           *
+ *      void                 *context : given back to write.                  *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                          : an empty writer.                      *
+ ******************************************************************************/
+void linkedListWriterInit(linkedListWriter_t *writer,
+                          linkedListSinkWrite_t write, void *context)
+{
+    writer->write     = write;
+    writer->context   = context;
+    writer->fd        = -1;
+    writer->format    = LINKED_LIST_WRITER_FIXED;
+    writer->precision = 1;
+    writer->failed    = 0;
+    writer->used      = 0;
+}
+
+/******************************************************************************
+ * linkedListWriterInitFd                                                     *
+ ******************************************************************************
+ * description: initializes a writer on a file descriptor.                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      int                 fd     : open file descriptor.                    *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : an empty writer.                         *
+ ******************************************************************************/
+void linkedListWriterInitFd(linkedListWriter_t *writer, int fd)
+{
+    linkedListWriterInit(writer, linkedListFdWrite, &writer->fd);
+    writer->fd = fd;
+}
+
+/******************************************************************************
+ * linkedListWriterInitFile                                                   *
+ ******************************************************************************
+ * description: initializes a writer on a FILE stream. The stream is written  *
+ *              once per chunk, so output written to it before, or after the  *
+ *              writer is flushed, keeps its order.                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      FILE               *stream : output stream (e.g, stdout).             *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : an empty writer.                         *
+ ******************************************************************************/
+void linkedListWriterInitFile(linkedListWriter_t *writer, FILE *stream)
+{
+    linkedListWriterInit(writer, linkedListFileWrite, stream);
+}
+
+/******************************************************************************
+ * linkedListWriterInitMemory                                                 *
+ ******************************************************************************
+ * description: initializes a writer on a memory buffer of the caller. What   *
+ *              does not fit in the buffer is dropped, and the writer fails.  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t     *writer : receives the writer address.         *
+ *      linkedListMemorySink_t *memory : buffer, capacity and size written.   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                           : an empty writer.                     *
+ ******************************************************************************/
+void linkedListWriterInitMemory(linkedListWriter_t *writer,
+                                linkedListMemorySink_t *memory)
+{
+    linkedListWriterInit(writer, linkedListMemoryWrite, memory);
+}
+
+/******************************************************************************
+ * linkedListWriterFormat                                                     *
+ ******************************************************************************
+ * description: chooses how the next values are written.                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t      *writer    : receives the writer address.     *
+ *      linkedListWriterFormat_t format    : FIXED, SHORTEST or BINARY.       *
+ *      natural                  precision : decimals of the FIXED format     *
+ *                                           (40 at most).                    *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                               : the writer, in the new format.   *
+ ******************************************************************************/
+void linkedListWriterFormat(linkedListWriter_t *writer,
+                            linkedListWriterFormat_t format,
+                            natural precision)
+{
+    if (precision > WRITER_MAX_PRECISION) precision = WRITER_MAX_PRECISION;
+
+    writer->format    = format;
+    writer->precision = precision;
+}
+
+/******************************************************************************
+ * linkedListWriterBytes                                                      *
+ ******************************************************************************
+ * description: writes raw bytes. Large blocks go straight to the sink.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      void               *bytes  : bytes to write.                          *
+ *      size_t              size   : number of bytes.                         *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the bytes, buffered or written.          *
+ ******************************************************************************/
+void linkedListWriterBytes(linkedListWriter_t *writer, const void *bytes,
+                           size_t size)
+{
+    if (size >= LINKED_LIST_WRITER_BUFFER)
+    {
+        linkedListWriterFlush(writer);
+        if (!writer->write(writer->context, bytes, size)) writer->failed = 1;
+        return ;
+    }
+
+    memcpy(linkedListWriterReserve(writer, size), bytes, size);
+    writer->used += size;
+}
+
+/******************************************************************************
+ * linkedListWriterText                                                       *
+ ******************************************************************************
+ * description: writes a text, without its terminating null character.       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      const char         *text   : null-terminated text.                    *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the text, buffered or written.           *
+ ******************************************************************************/
+void linkedListWriterText(linkedListWriter_t *writer, const char *text)
+{
+    linkedListWriterBytes(writer, text, strlen(text));
+}
+
+/******************************************************************************
+ * linkedListWriterReal                                                       *
+ ******************************************************************************
+ * description: writes a value, in the format of the writer.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      real                value  : a double data value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the value, buffered or written.          *
+ ******************************************************************************/
+void linkedListWriterReal(linkedListWriter_t *writer, real value)
+{
+    char *text = linkedListWriterReserve(writer, WRITER_MAX_REAL);
+
+    switch(writer->format)
+    {
+        case LINKED_LIST_WRITER_FIXED:
+            writer->used += linkedListWriterFixed(text, value,
+                                                  writer->precision);
+            break;
+
+        case LINKED_LIST_WRITER_SHORTEST:
+            writer->used += linkedListWriterShortest(text, value);
+            break;
+
+        case LINKED_LIST_WRITER_BINARY:
+            memcpy(text, &value, sizeof(real));
+            writer->used += sizeof(real);
+            break;
+    }
+}
+
+/******************************************************************************
+ * linkedListWriterList                                                       *
+ ******************************************************************************
+ * description: writes every value of a list. The text formats write it as   *
+ *              linkedListTransverse prints it, and the binary one writes the *
+ *              values only.                                                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *      linkedList_t       *list   : receives the list address (e.g, &list).  *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the list, buffered or written.           *
+ ******************************************************************************/
+void linkedListWriterList(linkedListWriter_t *writer,
+                          const linkedList_t *list)
+{
+    const linkedList_t *current = list;
+    int text = writer->format != LINKED_LIST_WRITER_BINARY;
+
+    if (text) linkedListWriterBytes(writer, "linkedList::[", 13);
+    while(current != NULL)
+    {
+        if (text)
+        {
+            /*room for the separator and the value, flushed at most once*/
+            linkedListWriterReserve(writer, WRITER_MAX_REAL + 1);
+            writer->buffer[writer->used++] = ' ';
+        }
+        linkedListWriterReal(writer, current->data);
+        current = current->next;
+    }
+    if (text) linkedListWriterBytes(writer, " ]\n", 3);
+}
+
+/******************************************************************************
+ * linkedListWriterFlush                                                      *
+ ******************************************************************************
+ * description: hands the buffered bytes to the sink (a FILE stream is not   *
+ *              flushed itself).                                              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      linkedListWriter_t *writer : receives the writer address (&writer).   *
+ *                                                                            *
+ * output:                                                                    *
+ *      int                        : 1 if every write so far succeeded, 0     *
+ *                                   otherwise.                               *
+ ******************************************************************************/
+int linkedListWriterFlush(linkedListWriter_t *writer)
+{
+    if (writer->used > 0)
+    {
+        if (!writer->write(writer->context, writer->buffer, writer->used))
+        {
+            writer->failed = 1;
+        }
+        writer->used = 0;
+    }
+
+    return !writer->failed;
+}
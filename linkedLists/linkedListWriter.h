@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                         BUFFERED LIST WRITER                               *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * A writer serializes values into its own buffer, and hands the buffer to a  *
+ * sink each time it is full: a file descriptor, a FILE stream, a memory      *
+ * buffer given by the caller, or any write function. A list of any size is   *
+ * streamed in chunks of LINKED_LIST_WRITER_BUFFER bytes, with no copy of the *
+ * whole list, and a FILE stream is only locked once per chunk.               *
+ *                                                                            *
+ * The values are written as:                                                 *
+ *                                                                            *
+ *  - FIXED    : as printf("%.*f") with the chosen precision (1 by default,  *
+ *               as linkedListTransverse prints), though most values are      *
+ *               rounded and written without calling printf.                 *
+ *  - SHORTEST : the fewest digits that read back to the same double, e.g.   *
+ *               0.1 instead of 0.10000000000000001, found without printf     *
+ *               by the Ryu algorithm and laid out as %.17g lays them out:    *
+ *               integers as such, and 5e-324 for the smallest subnormal.     *
+ *  - BINARY   : the 8 bytes of each double, in the machine byte order.       *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __LINKED_LIST_WRITER_H__
+#define __LINKED_LIST_WRITER_H__
+
+#include "linkedList.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+/*Bytes handed to the sink at once*/
+#define LINKED_LIST_WRITER_BUFFER 16384
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef enum linkedListWriterFormat
+{
+    LINKED_LIST_WRITER_FIXED = 0,
+    LINKED_LIST_WRITER_SHORTEST,
+    LINKED_LIST_WRITER_BINARY
+
+} linkedListWriterFormat_t;
+
+/*Writes size bytes, returning 1 on success and 0 otherwise*/
+typedef int (*linkedListSinkWrite_t)(void *context, const void *bytes,
+                                     size_t size);
+
+typedef struct linkedListMemorySink
+{
+    char   *data;       /*given by the caller*/
+    size_t  capacity;
+    size_t  size;       /*bytes written so far*/
+
+} linkedListMemorySink_t;
+
+typedef struct linkedListWriter
+{
+    linkedListSinkWrite_t     write;
+    void                     *context;
+    int                       fd;        /*context of the fd sink*/
+    linkedListWriterFormat_t  format;
+    natural                   precision;
+    int                       failed;    /*a write to the sink failed*/
+    size_t                    used;
+    char                      buffer[LINKED_LIST_WRITER_BUFFER];
+
+} linkedListWriter_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void linkedListWriterInit(linkedListWriter_t *writer,
+                          linkedListSinkWrite_t write, void *context);
+void linkedListWriterInitFd(linkedListWriter_t *writer, int fd);
+void linkedListWriterInitFile(linkedListWriter_t *writer, FILE *stream);
+void linkedListWriterInitMemory(linkedListWriter_t *writer,
+                                linkedListMemorySink_t *memory);
+void linkedListWriterFormat(linkedListWriter_t *writer,
+                            linkedListWriterFormat_t format,
+                            natural precision);
+void linkedListWriterBytes(linkedListWriter_t *writer, const void *bytes,
+                           size_t size);
+void linkedListWriterText(linkedListWriter_t *writer, const char *text);
+void linkedListWriterReal(linkedListWriter_t *writer, real value);
+void linkedListWriterList(linkedListWriter_t *writer,
+                          const linkedList_t *list);
+int linkedListWriterFlush(linkedListWriter_t *writer);
+
+#endif
+/*****END*****/
@@ -0,0 +1,350 @@
+/******************************************************************************
+ *                            DATA STRUCTURES                                 *
+ *                          LIST WRITER CHECK                                 *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Usage: linkedListWriterCheck [seed] [values]                               *
+ *                                                                            *
+ *  - FIXED, for every precision from 0 to 8 (the digits written without      *
+ *    printf), must give the bytes of snprintf("%.*f"): on edge values (the   *
+ *    2^40 bound of the fast path, ties and the window around them, -0.0,     *
+ *    negatives rounding to zero, huge, tiny and non-finite values) and on    *
+ *    random values of every magnitude.                                       *
+ *  - SHORTEST must read back through strtod to the very same double, and    *
+ *    with no more digits than the fewest printf("%.*e") needs to read back: *
+ *    the same digits when as many, as both round to the nearest.            *
+ *  - A memory sink too small must keep what fits and report the truncation, *
+ *    and a list longer than the buffer must be written whole.                *
+ *                                                                            *
+ * The exit code is 1 on the first difference, which is written to stderr.   *
+ ******************************************************************************/
+
+#include "linkedList.h"
+#include "linkedListWriter.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*The largest FIXED precision written without printf*/
+#define WRITER_CHECK_PRECISION 8
+/*Longest text of a value: %.8f of DBL_MAX takes 318 bytes*/
+#define WRITER_CHECK_TEXT      512
+
+static linkedListWriter_t writer;
+static char written[WRITER_CHECK_TEXT];
+
+static unsigned long long writerCheckState;
+
+static unsigned long long writerCheckRandom(void)
+{
+    /*xorshift64: the same seed gives the same values*/
+    writerCheckState ^= writerCheckState << 13;
+    writerCheckState ^= writerCheckState >> 7;
+    writerCheckState ^= writerCheckState << 17;
+    return writerCheckState;
+}
+
+/*The text a writer gives for one value, in written*/
+static const char *writerCheckReal(linkedListWriterFormat_t format,
+                                   natural precision, real value)
+{
+    linkedListMemorySink_t memory = { written, sizeof(written) - 1, 0 };
+
+    linkedListWriterInitMemory(&writer, &memory);
+    linkedListWriterFormat(&writer, format, precision);
+    linkedListWriterReal(&writer, value);
+    linkedListWriterFlush(&writer);
+    written[memory.size] = '\0';
+
+    return written;
+}
+
+static int writerCheckFixed(real value)
+{
+    char expected[WRITER_CHECK_TEXT];
+    natural precision;
+
+    for(precision = 0; precision <= WRITER_CHECK_PRECISION; precision++)
+    {
+        snprintf(expected, sizeof(expected), "%.*f", (int) precision, value);
+        writerCheckReal(LINKED_LIST_WRITER_FIXED, precision, value);
+
+        if (strcmp(written, expected) != 0)
+        {
+            fprintf(stderr, "linkedListWriterCheck::FIXED %.17g precision "
+                    "%d: \"%s\", printf \"%s\"\n", value, precision, written,
+                    expected);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*The significant digits of a text, with no sign, point nor zeros around*/
+static size_t writerCheckSignificand(const char *text, char *digits)
+{
+    size_t length = 0;
+
+    for(; *text != '\0' && *text != 'e'; text++)
+    {
+        if (*text < '0' || *text > '9') continue;
+        if (length == 0 && *text == '0') continue;
+        digits[length++] = *text;
+    }
+    while(length > 0 && digits[length - 1] == '0') length--;
+    digits[length] = '\0';
+
+    return length;
+}
+
+static int writerCheckShortest(real value)
+{
+    char expected[WRITER_CHECK_TEXT], digits[WRITER_CHECK_TEXT];
+    char shortest[WRITER_CHECK_TEXT];
+    real back;
+    int precision;
+
+    writerCheckReal(LINKED_LIST_WRITER_SHORTEST, 0, value);
+    back = strtod(written, NULL);
+
+    if (isnan(value) ? !isnan(back) :
+        memcmp(&back, &value, sizeof(real)) != 0)
+    {
+        fprintf(stderr, "linkedListWriterCheck::SHORTEST %.17g: \"%s\" "
+                "reads back as %.17g\n", value, written, back);
+        return 0;
+    }
+    if (!isfinite(value) || value == 0) return 1;
+
+    /*the reference: the fewest digits of printf that read back*/
+    for(precision = 0; precision < 17; precision++)
+    {
+        snprintf(expected, sizeof(expected), "%.*e", precision, value);
+        if (strtod(expected, NULL) == value) break;
+    }
+
+    writerCheckSignificand(expected, shortest);
+    if (writerCheckSignificand(written, digits) > strlen(shortest) ||
+        (strlen(digits) == strlen(shortest) && strcmp(digits, shortest) != 0))
+    {
+        fprintf(stderr, "linkedListWriterCheck::SHORTEST %.17g: \"%s\", "
+                "printf \"%s\"\n", value, written, expected);
+        return 0;
+    }
+
+    return 1;
+}
+
+static int writerCheckValue(real value)
+{
+    return writerCheckFixed(value) && writerCheckShortest(value);
+}
+
+/*Values at, around and inside the WRITER_TIE window of every precision*/
+static int writerCheckTies(natural count)
+{
+    static const real offsets[] =
+    {
+        0, 1.0 / 4096, 1.0 / 1024, 1.0 / 512, 1.0 / 64
+    };
+    real power, integer, tie;
+    natural precision, i, k;
+
+    for(precision = 0; precision <= WRITER_CHECK_PRECISION; precision++)
+    {
+        power = pow(10, precision);
+        for(i = 0; i < count; i++)
+        {
+            integer = (real) (writerCheckRandom() % 100000000);
+            for(k = 0; k < sizeof(offsets) / sizeof(offsets[0]); k++)
+            {
+                tie = (integer + 0.5 + offsets[k]) / power;
+                if (!writerCheckValue(tie) || !writerCheckValue(-tie))
+                {
+                    return 0;
+                }
+                tie = (integer + 0.5 - offsets[k]) / power;
+                if (!writerCheckValue(nextafter(tie, 0)) ||
+                    !writerCheckValue(nextafter(tie, INFINITY)))
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+static int writerCheckEdges(void)
+{
+    static const real edges[] =
+    {
+        0.0, -0.0, 0.5, -0.5, 1.5, 2.5, -2.5, 0.05, 0.15, 0.25, 0.35, 1.005,
+        -0.04, -0.4, -0.000000004, -0.0000000049, 1e-9, -1e-9, 0.1, 0.2, 0.3,
+        1.0 / 3, 2.0 / 3, 123456.789, 999999.9999999, 9.999999995,
+        1e15, 1e16, 1e17, 9007199254740993.0, 1e300, -1e300, DBL_MAX,
+        -DBL_MAX, DBL_MIN, -DBL_MIN, 4.9406564584124654e-324
+    };
+    static const struct { real value; const char *text; } texts[] =
+    {
+        { 3, "3" }, { -42, "-42" }, { 0.1, "0.1" }, { -0.0, "-0" },
+        { 0.0, "0" }, { 123.25, "123.25" }, { 0.0001, "0.0001" },
+        { 1e-5, "1e-05" }, { -1.5e-7, "-1.5e-07" },
+        { 1e16, "10000000000000000" }, { 1e17, "1e+17" },
+        { 1.2e300, "1.2e+300" }, { 5e-324, "5e-324" },
+        { DBL_MAX, "1.7976931348623157e+308" },
+        { 1.0 / 3, "0.3333333333333333" }, { INFINITY, "inf" },
+        { -INFINITY, "-inf" }
+    };
+    real bound, power;
+    natural precision, i;
+
+    for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++)
+    {
+        if (!writerCheckValue(edges[i])) return 0;
+    }
+
+    /*non-finite values go to printf, and SHORTEST writes them as %g does*/
+    if (!writerCheckFixed(INFINITY) || !writerCheckFixed(-INFINITY) ||
+        !writerCheckFixed(NAN) || !writerCheckShortest(INFINITY) ||
+        !writerCheckShortest(-INFINITY) || !writerCheckShortest(NAN))
+    {
+        return 0;
+    }
+
+    /*the fast path stops where the scaled value reaches 2^40*/
+    for(precision = 0; precision <= WRITER_CHECK_PRECISION; precision++)
+    {
+        power = pow(10, precision);
+        bound = ldexp(1.0, 40) / power;
+        if (!writerCheckValue(bound) || !writerCheckValue(-bound) ||
+            !writerCheckValue(nextafter(bound, 0)) ||
+            !writerCheckValue(nextafter(bound, INFINITY)) ||
+            !writerCheckValue((ldexp(1.0, 40) - 0.5) / power) ||
+            !writerCheckValue((ldexp(1.0, 40) - 1.5) / power))
+        {
+            return 0;
+        }
+    }
+
+    /*the integers, without a decimal point, and the shortest decimals*/
+    for(i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+        writerCheckReal(LINKED_LIST_WRITER_SHORTEST, 0, texts[i].value);
+        if (strcmp(written, texts[i].text) != 0)
+        {
+            fprintf(stderr, "linkedListWriterCheck::SHORTEST gave \"%s\" "
+                    "instead of \"%s\"\n", written, texts[i].text);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*Random values of every magnitude, and random bit patterns for SHORTEST*/
+static int writerCheckRandomValues(natural count)
+{
+    unsigned long long bits;
+    real value;
+    natural i;
+
+    for(i = 0; i < count; i++)
+    {
+        value = ldexp((real) (writerCheckRandom() >> 11), -53);
+        value = ldexp(value, (int) (writerCheckRandom() % 80) - 34);
+        if (writerCheckRandom() & 1) value = -value;
+        if (!writerCheckValue(value)) return 0;
+
+        bits = writerCheckRandom();
+        memcpy(&value, &bits, sizeof(real));
+        if (isfinite(value) && !writerCheckShortest(value)) return 0;
+    }
+
+    return 1;
+}
+
+static int writerCheckSinks(void)
+{
+    static char expected[4 * LINKED_LIST_WRITER_BUFFER];
+    static char output[4 * LINKED_LIST_WRITER_BUFFER];
+    linkedListMemorySink_t memory = { output, sizeof(output), 0 };
+    linkedList_t *list = NULL;
+    size_t length;
+    natural i;
+
+    /*a list of about twice the buffer, as linkedListTransverse prints it*/
+    length = (size_t) snprintf(expected, sizeof(expected), "linkedList::[");
+    for(i = 0; i < 3000; i++)
+    {
+        linkedListAddBegin(&list, 2999.25 - i);
+    }
+    for(i = 0; i < 3000; i++)
+    {
+        length += (size_t) snprintf(expected + length,
+                                    sizeof(expected) - length, " %1.1f",
+                                    (real) i + 0.25);
+    }
+    length += (size_t) snprintf(expected + length, sizeof(expected) - length,
+                                " ]\n");
+
+    linkedListWriterInitMemory(&writer, &memory);
+    linkedListWriterList(&writer, list);
+    if (!linkedListWriterFlush(&writer) || memory.size != length ||
+        memcmp(output, expected, length) != 0)
+    {
+        fprintf(stderr, "linkedListWriterCheck::the list differs from "
+                "linkedListTransverse\n");
+        linkedListFree(list);
+        return 0;
+    }
+
+    /*a sink too small keeps what fits, and the writer reports the loss*/
+    memory.capacity = LINKED_LIST_WRITER_BUFFER + 100;
+    memory.size     = 0;
+    linkedListWriterInitMemory(&writer, &memory);
+    linkedListWriterList(&writer, list);
+    linkedListFree(list);
+
+    if (linkedListWriterFlush(&writer) || linkedListWriterFlush(&writer) ||
+        memory.size != memory.capacity ||
+        memcmp(output, expected, memory.size) != 0)
+    {
+        fprintf(stderr, "linkedListWriterCheck::the memory sink did not "
+                "report the truncation\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long long seed = 1;
+    natural values = 20000;
+
+    if (argc > 1) seed   = strtoull(argv[1], NULL, 10);
+    if (argc > 2) values = (natural) strtoul(argv[2], NULL, 10);
+    writerCheckState = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    if (!writerCheckEdges() || !writerCheckTies(values / 100) ||
+        !writerCheckRandomValues(values) || !writerCheckSinks())
+    {
+        return 1;
+    }
+
+    fprintf(stderr, "linkedListWriterCheck::[ seed %llu values %d ]\n", seed,
+            values);
+
+    return 0;
+}
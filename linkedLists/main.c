@@ -6,7 +6,7 @@
  * E-mail: almeriopamplona@gmail.com                                          *
  ******************************************************************************
  * Creation:     20.03.2021                                                   *
- * Modification: 21.03.2021                                                   *
+ * Modification: 17.10.2026                                                   *
  ******************************************************************************
  * REFERENCE:                                                                 *
  *                                                                            *
@@ -18,8 +18,23 @@
  ******************************************************************************/
 
 #include "linkedList.h"
+#include "linkedListPool.h"
+#include "unrolledList.h"
+#include "linkedListSort.h"
+#include "skipList.h"
+#include "doublyList.h"
+#include "linkedListGeneric.h"
 #include <stdio.h>
 
+/*A list of int values, generated for its own payload type*/
+LINKED_LIST_DEFINE(intList, int)
+
+static void intListPrint(int *value, void *context)
+{
+    (void) context;
+    printf(" %d", *value);
+}
+
 int main()
 {
     /*Creating a head for the linked list*/
@@ -71,5 +86,127 @@ int main()
     /*Free memory*/
     linkedListFree(list);
 
+    /*The same list, but owned by a handle: appends do not walk the list*/
+    linkedListHandle_t handle;
+    linkedListHandleInit(&handle);
+    for(i = 3; i < 7; i++)
+    {
+        linkedListHandleAppend(&handle, i);
+    }
+    linkedListHandlePrepend(&handle, 2);
+    linkedListHandleTransverse(&handle);
+    printf("linkedList::size::[ %d ]\n", linkedListHandleSize(&handle));
+
+    /*Walking the list with a cursor: one node per step, no restarts*/
+    linkedListCursor_t cursor;
+    printf("linkedList::cursor::[");
+    for(linkedListCursorBegin(&cursor, &handle); 
+        linkedListCursorValid(&cursor); linkedListCursorNext(&cursor))
+    {
+        linkedListCursorSet(&cursor, 2 * linkedListCursorGet(&cursor));
+        printf(" %1.1f", linkedListCursorGet(&cursor));
+    }
+    printf(" ]\n");
+
+    /*Removing the first and the last nodes*/
+    linkedListHandlePopFront(&handle);
+    linkedListHandleRemoveLast(&handle);
+    linkedListHandleTransverse(&handle);
+
+    /*Many edits in a single walk: the indexes refer to the list before them*/
+    linkedListEdit_t edits[] =
+    {
+        { LINKED_LIST_EDIT_SET,    2, 0.5 },
+        { LINKED_LIST_EDIT_INSERT, 0, 1.0 },
+        { LINKED_LIST_EDIT_REMOVE, 1, 0.0 },
+        { LINKED_LIST_EDIT_INSERT, 9, 9.0 },
+    };
+    linkedListHandleApply(&handle, edits, 4);
+    linkedListHandleTransverse(&handle);
+
+    /*Free memory*/
+    linkedListHandleFree(&handle);
+
+    /*A handle whose nodes come from a pool, instead of one malloc per node*/
+    linkedListPool_t pool;
+    linkedListPoolInit(&pool, 1024);
+    linkedListHandleInitWith(&handle, linkedListPoolAllocator(&pool));
+    for(i = 1; i < 5; i++)
+    {
+        linkedListHandleAppend(&handle, i);
+    }
+    linkedListHandleTransverse(&handle);
+
+    /*Sorting the list, by relinking its nodes*/
+    linkedListHandlePrepend(&handle, 7);
+    linkedListHandleAppend(&handle, 0);
+    linkedListHandleSort(&handle);
+    linkedListHandleTransverse(&handle);
+
+    /*The whole list goes back to the pool at once, then the pool is freed*/
+    linkedListHandleFree(&handle);
+    linkedListPoolDestroy(&pool);
+
+    /*An unrolled list keeps up to 14 values per node*/
+    unrolledList_t unrolled;
+    unrolledListInit(&unrolled);
+    for(i = 0; i < 20; i++)
+    {
+        unrolledListAddEnd(&unrolled, i);
+    }
+    unrolledListAddByIndex(&unrolled, 15, 1);
+    unrolledListRemoveByIndex(&unrolled, 5);
+    unrolledListTransverse(&unrolled);
+
+    /*Free memory*/
+    unrolledListFree(&unrolled);
+
+    /*A skip list kept in order, with lookups by value and by index*/
+    skipList_t skip;
+    natural position;
+    skipListInit(&skip);
+    for(i = 0; i < 12; i++)
+    {
+        skipListInsertSorted(&skip, (7 * i) % 12);
+    }
+    skipListTransverse(&skip);
+    if (skipListFind(&skip, 5, &position))
+    {
+        printf("5.0 is at index %u\n", position);
+    }
+    printf("value at index 10: %1.1f\n", skipListGet(&skip, 10));
+
+    /*Free memory*/
+    skipListFree(&skip);
+
+    /*A doubly linked list removes at both ends, or a known node, in O(1)*/
+    doublyList_t doubly;
+    doublyListInit(&doubly);
+    for(i = 0; i < 6; i++)
+    {
+        doublyListAddEnd(&doubly, i);
+    }
+    doublyListRemoveLast(&doubly);
+    doublyListRemoveNode(&doubly, doublyListNodeAt(&doubly, 2));
+    doublyListTransverse(&doubly);
+
+    /*Free memory*/
+    doublyListFree(&doubly);
+
+    /*The int list keeps its values inside the nodes, without boxing*/
+    intList_t ints;
+    intListInit(&ints);
+    for(i = 0; i < 6; i++)
+    {
+        int value = (5 * i) % 6;
+        intListInsertSorted(&ints, &value);
+    }
+    printf("intList::[");
+    intListForEach(&ints, intListPrint, NULL);
+    printf(" ]\n");
+
+    /*Free memory*/
+    intListFree(&ints);
+
     return 0;
 }
@@ -0,0 +1,508 @@
+/******************************************************************************
+ *                          INDEXABLE SKIP LISTS                              *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * The head is at rank 0 and the i-th value at rank i+1. The span of a link   *
+ * is the rank of its next node minus the rank of its node, and a link to     *
+ * NULL spans up to rank size+1, so insertions and removals update every span *
+ * in the same way, whether the link points to a node or not.                 *
+ ******************************************************************************/
+
+#include "skipList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*Each level is kept with probability 1/4*/
+#define SKIP_LIST_BRANCHING 4
+
+static size_t skipListNodeSize(natural level)
+{
+    return sizeof(skipListNode_t) + level * sizeof(skipListLink_t);
+}
+
+static natural skipListRandomLevel(skipList_t *list)
+{
+    natural level = 1;
+
+    /*xorshift64*/
+    list->seed ^= list->seed << 13;
+    list->seed ^= list->seed >> 7;
+    list->seed ^= list->seed << 17;
+
+    unsigned long long bits = list->seed;
+    while(level < SKIP_LIST_MAX_LEVEL && (bits % SKIP_LIST_BRANCHING) == 0)
+    {
+        level++;
+        bits /= SKIP_LIST_BRANCHING;
+    }
+
+    return level;
+}
+
+/*Finds, at every level, the last node whose rank is smaller than rank*/
+static void skipListPath(const skipList_t *list, natural rank,
+                         skipListNode_t **update, natural *ranks)
+{
+    skipListNode_t *current = list->head;
+    natural traversed = 0;
+    int level;
+
+    for(level = (int) list->level - 1; level >= 0; level--)
+    {
+        while(current->links[level].next != NULL && 
+              traversed + current->links[level].span < rank)
+        {
+            traversed += current->links[level].span;
+            current = current->links[level].next;
+        }
+        update[level] = current;
+        ranks[level]  = traversed;
+    }
+}
+
+/*Node at rank (1 to size), following the spans*/
+static skipListNode_t *skipListAtRank(const skipList_t *list, natural rank)
+{
+    skipListNode_t *current = list->head;
+    natural traversed = 0;
+    int level;
+
+    for(level = (int) list->level - 1; level >= 0; level--)
+    {
+        while(current->links[level].next != NULL && 
+              traversed + current->links[level].span <= rank)
+        {
+            traversed += current->links[level].span;
+            current = current->links[level].next;
+        }
+        if (traversed == rank) return current;
+    }
+
+    return current;
+}
+
+/*Links a new node at rank, right after the nodes of the path*/
+static void skipListLink(skipList_t *list, real data, natural rank,
+                         skipListNode_t **update, natural *ranks)
+{
+    natural level = skipListRandomLevel(list);
+    natural i;
+
+    /*the new levels start at the head, and span up to the end of the list*/
+    for(i = list->level; i < level; i++)
+    {
+        update[i] = list->head;
+        ranks[i]  = 0;
+        list->head->links[i].next = NULL;
+        list->head->links[i].span = list->size + 1;
+    }
+    if (level > list->level) list->level = level;
+
+    skipListNode_t *node = 
+        (skipListNode_t*) linkedListPoolAlloc(&list->pools[level-1]);
+    node->data  = data;
+    node->level = level;
+
+    for(i = 0; i < level; i++)
+    {
+        skipListLink_t *before = &update[i]->links[i];
+
+        /*the node after the link moves one rank forward*/
+        node->links[i].next = before->next;
+        node->links[i].span = ranks[i] + before->span + 1 - rank;
+        before->next = node;
+        before->span = rank - ranks[i];
+    }
+    /*the levels above the node jump over one more position*/
+    for(; i < list->level; i++) update[i]->links[i].span++;
+
+    list->size++;
+}
+
+/*Unlinks the node at rank, right after the nodes of the path*/
+static void skipListUnlink(skipList_t *list, skipListNode_t **update)
+{
+    skipListNode_t *node = update[0]->links[0].next;
+    natural i;
+
+    for(i = 0; i < list->level; i++)
+    {
+        skipListLink_t *before = &update[i]->links[i];
+
+        if (before->next == node)
+        {
+            before->span += node->links[i].span - 1;
+            before->next  = node->links[i].next;
+        }
+        else
+        {
+            before->span--;
+        }
+    }
+
+    while(list->level > 1 && list->head->links[list->level-1].next == NULL)
+    {
+        list->level--;
+    }
+
+    linkedListPoolRelease(&list->pools[node->level-1], node);
+    list->size--;
+}
+
+/******************************************************************************
+ * skipListInit                                                               *
+ ******************************************************************************
+ * description: initializes an empty skip list and its node pools.            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void skipListInit(skipList_t *list)
+{
+    natural i, blocks;
+
+    list->head = (skipListNode_t*) malloc(skipListNodeSize(SKIP_LIST_MAX_LEVEL));
+    list->head->data  = 0;
+    list->head->level = SKIP_LIST_MAX_LEVEL;
+    list->head->links[0].next = NULL;
+    list->head->links[0].span = 1;
+
+    list->level = 1;
+    list->size  = 0;
+    list->seed  = 88172645463325252ULL;
+
+    /*there are about 4 times fewer nodes at each level up*/
+    for(i = 0, blocks = 1024; i < SKIP_LIST_MAX_LEVEL; i++)
+    {
+        linkedListPoolInitSized(&list->pools[i], skipListNodeSize(i + 1), 
+                                blocks);
+        if (blocks > 16) blocks /= SKIP_LIST_BRANCHING;
+    }
+}
+
+/******************************************************************************
+ * skipListFree                                                               *
+ ******************************************************************************
+ * description: frees every node of the list, by giving the pools back at     *
+ *              once, and its head. The list must be initialized again to be  *
+ *              reused.                                                       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a released list.                              *
+ ******************************************************************************/
+void skipListFree(skipList_t *list)
+{
+    natural i;
+
+    for(i = 0; i < SKIP_LIST_MAX_LEVEL; i++) 
+    {
+        linkedListPoolDestroy(&list->pools[i]);
+    }
+
+    free(list->head);
+    list->head  = NULL;
+    list->level = 0;
+    list->size  = 0;
+}
+
+/******************************************************************************
+ * skipListSize                                                               *
+ ******************************************************************************
+ * description: returns the number of values in the list.                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural               : number of values in the list.                 *
+ ******************************************************************************/
+natural skipListSize(const skipList_t *list)
+{
+    return list->size;
+}
+
+/******************************************************************************
+ * skipListAddBegin                                                           *
+ ******************************************************************************
+ * description: adds a new value at the beginning of the list.                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the beginning of the list.     *
+ ******************************************************************************/
+void skipListAddBegin(skipList_t *list, real data)
+{
+    skipListAddByIndex(list, data, 0);
+}
+
+/******************************************************************************
+ * skipListAddEnd                                                             *
+ ******************************************************************************
+ * description: adds a new value at the end of the list.                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the end of the list.           *
+ ******************************************************************************/
+void skipListAddEnd(skipList_t *list, real data)
+{
+    skipListAddByIndex(list, data, list->size);
+}
+
+/******************************************************************************
+ * skipListAddByIndex                                                         *
+ ******************************************************************************
+ * description: adds a new value at some specific position of the list, in    *
+ *              O(log n) expected. An index beyond the last position appends  *
+ *              the value.                                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : unsigned int index value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void skipListAddByIndex(skipList_t *list, real data, natural index)
+{
+    skipListNode_t *update[SKIP_LIST_MAX_LEVEL];
+    natural ranks[SKIP_LIST_MAX_LEVEL];
+
+    if (index > list->size) index = list->size;
+
+    skipListPath(list, index + 1, update, ranks);
+    skipListLink(list, data, index + 1, update, ranks);
+}
+
+/******************************************************************************
+ * skipListRemoveLast                                                         *
+ ******************************************************************************
+ * description: removes the last value of the list.                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the last value.                *
+ ******************************************************************************/
+void skipListRemoveLast(skipList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    skipListRemoveByIndex(list, list->size - 1);
+}
+
+/******************************************************************************
+ * skipListRemoveFirst                                                        *
+ ******************************************************************************
+ * description: removes the first value of the list.                          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the first value.               *
+ ******************************************************************************/
+void skipListRemoveFirst(skipList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    skipListRemoveByIndex(list, 0);
+}
+
+/******************************************************************************
+ * skipListRemoveByIndex                                                      *
+ ******************************************************************************
+ * description: removes a value at a specific position, in O(log n) expected. *
+ *              Indexes beyond the last position are ignored.                 *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the value at the desired       *
+ *                              position.                                     *
+ ******************************************************************************/
+void skipListRemoveByIndex(skipList_t *list, natural index)
+{
+    skipListNode_t *update[SKIP_LIST_MAX_LEVEL];
+    natural ranks[SKIP_LIST_MAX_LEVEL];
+
+    if (index >= list->size) return ;
+
+    skipListPath(list, index + 1, update, ranks);
+    skipListUnlink(list, update);
+}
+
+/******************************************************************************
+ * skipListSet                                                                *
+ ******************************************************************************
+ * description: sets a new value at the desired position of the list, in      *
+ *              O(log n) expected.                                            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void skipListSet(skipList_t *list, real data, natural index)
+{
+    if (index >= list->size) return ;
+
+    skipListAtRank(list, index + 1)->data = data;
+}
+
+/******************************************************************************
+ * skipListGet                                                                *
+ ******************************************************************************
+ * description: gets the value at the desired position of the list, in       *
+ *              O(log n) expected.                                            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : value at the desired position (-1 and an      *
+ *                              error message if there is no such value).     *
+ ******************************************************************************/
+real skipListGet(const skipList_t *list, natural index)
+{
+    if (index >= list->size)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    return skipListAtRank(list, index + 1)->data;
+}
+
+/******************************************************************************
+ * skipListTransverse                                                         *
+ ******************************************************************************
+ * description: prints the list on the terminal screen.                       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : printed list on the terminal screen.          *
+ ******************************************************************************/
+void skipListTransverse(const skipList_t *list)
+{
+    skipListNode_t *current = list->head->links[0].next;
+
+    printf("skipList::[");
+    while(current != NULL)
+    {
+        printf(" %1.1f", current->data);
+        current = current->links[0].next;
+    }
+    printf(" ]\n");
+}
+
+/******************************************************************************
+ * skipListInsertSorted                                                       *
+ ******************************************************************************
+ * description: adds a new value keeping the list in ascending order, in      *
+ *              O(log n) expected. Equal values keep their insertion order.   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at its ordered position.          *
+ ******************************************************************************/
+void skipListInsertSorted(skipList_t *list, real data)
+{
+    skipListNode_t *update[SKIP_LIST_MAX_LEVEL];
+    natural ranks[SKIP_LIST_MAX_LEVEL];
+    skipListNode_t *current = list->head;
+    natural traversed = 0;
+    int level;
+
+    /*the path goes past every value not larger than the new one*/
+    for(level = (int) list->level - 1; level >= 0; level--)
+    {
+        while(current->links[level].next != NULL && 
+              current->links[level].next->data <= data)
+        {
+            traversed += current->links[level].span;
+            current = current->links[level].next;
+        }
+        update[level] = current;
+        ranks[level]  = traversed;
+    }
+
+    skipListLink(list, data, traversed + 1, update, ranks);
+}
+
+/******************************************************************************
+ * skipListFind                                                               *
+ ******************************************************************************
+ * description: looks for a value in a list kept in ascending order, in       *
+ *              O(log n) expected.                                            *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      skipList_t     *list  : receives the list address (e.g, &list).       *
+ *      real            data  : the value looked for.                         *
+ *      natural        *index : receives the position of its first occurrence.*
+ *                                                                            *
+ * output:                                                                    *
+ *      int                   : 1 if the value was found, 0 otherwise.        *
+ ******************************************************************************/
+int skipListFind(const skipList_t *list, real data, natural *index)
+{
+    skipListNode_t *current = list->head;
+    natural traversed = 0;
+    int level;
+
+    /*stopping right before the first value not smaller than data*/
+    for(level = (int) list->level - 1; level >= 0; level--)
+    {
+        while(current->links[level].next != NULL && 
+              current->links[level].next->data < data)
+        {
+            traversed += current->links[level].span;
+            current = current->links[level].next;
+        }
+    }
+
+    current = current->links[0].next;
+    if (current == NULL || current->data != data) return 0;
+
+    *index = traversed;
+    return 1;
+}
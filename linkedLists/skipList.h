@@ -0,0 +1,84 @@
+/******************************************************************************
+ *                          INDEXABLE SKIP LISTS                              *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * This is a skip list whose forward pointers also carry their span, i.e. how *
+ * many positions they jump over. Summing the spans along a search gives the  *
+ * position of a node, so getting, setting, adding and removing by index are  *
+ * O(log n) expected, instead of O(index) in a linkedList_t.                  *
+ *                                                                            *
+ * The list can also be kept in ascending order of data, with the ordered     *
+ * insertion and the lookup by value, which are O(log n) expected as well.    *
+ * Adding by index, or setting values, does not keep the order: the ordered   *
+ * functions assume the list was only built by skipListInsertSorted.          *
+ *                                                                            *
+ * A node with k levels is a block of the pool for k levels, so nodes come    *
+ * from the same pool allocation as the base list (linkedListPool.h), and     *
+ * freeing the list gives every pool back at once.                           *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __SKIP_LIST_H__
+#define __SKIP_LIST_H__
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+
+#define SKIP_LIST_MAX_LEVEL 32
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct skipListLink
+{
+    struct skipListNode *next;
+    natural              span;
+
+} skipListLink_t;
+
+typedef struct skipListNode
+{
+    real           data;
+    natural        level;
+    skipListLink_t links[];
+
+} skipListNode_t;
+
+typedef struct skipList
+{
+    skipListNode_t     *head;      /*sentinel, with every level*/
+    natural             level;     /*levels in use*/
+    natural             size;
+    unsigned long long  seed;
+    linkedListPool_t    pools[SKIP_LIST_MAX_LEVEL];
+
+} skipList_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void skipListInit(skipList_t *list);
+void skipListFree(skipList_t *list);
+natural skipListSize(const skipList_t *list);
+void skipListAddBegin(skipList_t *list, real data);
+void skipListAddEnd(skipList_t *list, real data);
+void skipListAddByIndex(skipList_t *list, real data, natural index);
+void skipListRemoveLast(skipList_t *list);
+void skipListRemoveFirst(skipList_t *list);
+void skipListRemoveByIndex(skipList_t *list, natural index);
+void skipListSet(skipList_t *list, real data, natural index);
+real skipListGet(const skipList_t *list, natural index);
+void skipListTransverse(const skipList_t *list);
+void skipListInsertSorted(skipList_t *list, real data);
+int skipListFind(const skipList_t *list, real data, natural *index);
+
+#endif
+/*****END*****/
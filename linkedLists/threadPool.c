@@ -0,0 +1,465 @@
+/******************************************************************************
+ *                               THREAD POOL                                  *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "threadPool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define ATOMIC_ADD(counter, value) \
+    __atomic_add_fetch(&(counter), (value), __ATOMIC_ACQ_REL)
+#define ATOMIC_SUB(counter, value) \
+    __atomic_sub_fetch(&(counter), (value), __ATOMIC_ACQ_REL)
+#define ATOMIC_LOAD(counter) __atomic_load_n(&(counter), __ATOMIC_ACQUIRE)
+
+/*Deque of the worker running on this thread, if any*/
+static __thread threadPoolDeque_t *threadPoolOwn = NULL;
+
+/*Appends a job at the newest end of a deque, growing it when full*/
+static void threadPoolPush(threadPoolDeque_t *deque, threadPoolJob_t job)
+{
+    register natural i;
+
+    pthread_mutex_lock(&deque->mutex);
+
+    /*growing the circular buffer, keeping the jobs in order*/
+    if (deque->count == deque->capacity)
+    {
+        threadPoolJob_t *jobs = (threadPoolJob_t*) malloc(
+            2 * deque->capacity * sizeof(threadPoolJob_t));
+        for(i = 0; i < deque->count; i++)
+        {
+            jobs[i] = deque->jobs[(deque->first + i) % deque->capacity];
+        }
+        free(deque->jobs);
+        deque->jobs      = jobs;
+        deque->first     = 0;
+        deque->capacity *= 2;
+    }
+
+    deque->jobs[(deque->first + deque->count) % deque->capacity] = job;
+    deque->count++;
+
+    pthread_mutex_unlock(&deque->mutex);
+}
+
+/*Takes the newest job (owner) or the oldest one (thief) of a deque*/
+static int threadPoolTake(threadPoolDeque_t *deque, int newest,
+                          threadPoolJob_t *job)
+{
+    int taken = 0;
+
+    pthread_mutex_lock(&deque->mutex);
+    if (deque->count > 0)
+    {
+        if (newest)
+        {
+            *job = deque->jobs[(deque->first + deque->count - 1) % 
+                               deque->capacity];
+        }
+        else
+        {
+            *job = deque->jobs[deque->first];
+            deque->first = (deque->first + 1) % deque->capacity;
+        }
+        deque->count--;
+        ATOMIC_SUB(deque->pool->queued, 1);
+        taken = 1;
+    }
+    pthread_mutex_unlock(&deque->mutex);
+
+    return taken;
+}
+
+/*Own deque first, then the other ones, from the next worker on*/
+static int threadPoolFind(threadPoolDeque_t *own, threadPoolJob_t *job)
+{
+    threadPool_t *pool = own->pool;
+    natural index = (natural) (own - pool->deques);
+    natural size  = ATOMIC_LOAD(pool->size);   /*still growing at start up*/
+    register natural i;
+
+    if (threadPoolTake(own, 1, job)) return 1;
+
+    for(i = 1; i < size; i++)
+    {
+        if (threadPoolTake(&pool->deques[(index + i) % size], 0, job))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*A group waiter runs the jobs of its own deque, if it is a worker of the
+  pool, or else steals the oldest job of any deque*/
+static int threadPoolHelp(threadPool_t *pool, threadPoolJob_t *job)
+{
+    threadPoolDeque_t *own = threadPoolOwn;
+    natural size = ATOMIC_LOAD(pool->size);
+    register natural i;
+
+    if (own != NULL && own->pool == pool) return threadPoolFind(own, job);
+
+    for(i = 0; i < size; i++)
+    {
+        if (threadPoolTake(&pool->deques[i], 0, job)) return 1;
+    }
+
+    return 0;
+}
+
+/*Runs a job and counts it as finished, waking the waiters of the pool, or of
+  its group, once nothing of them is left*/
+static void threadPoolRun(threadPool_t *pool, threadPoolJob_t job)
+{
+    int done = 0;
+
+    job.task(job.argument);
+
+    /*the group may be gone as soon as its count reaches 0*/
+    if (job.group != NULL && ATOMIC_SUB(job.group->pending, 1) == 0) done = 1;
+    if (ATOMIC_SUB(pool->pending, 1) == 0) done = 1;
+
+    /*the lock orders the broadcast after the check of a waiter*/
+    if (done)
+    {
+        pthread_mutex_lock(&pool->mutex);
+        pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+/*Queues a counted job: into the deque of the calling worker, or else into
+  the deques in turn*/
+static void threadPoolQueue(threadPool_t *pool, threadPoolJob_t job)
+{
+    threadPoolDeque_t *deque = threadPoolOwn;
+
+    /*a task keeps its subtasks, the other submissions are dealt in turn*/
+    if (deque == NULL || deque->pool != pool)
+    {
+        deque = &pool->deques[__atomic_fetch_add(&pool->next, 1,
+                                                 __ATOMIC_RELAXED) %
+                              pool->size];
+    }
+
+    /*counted first, so that the counters never fall below the jobs*/
+    ATOMIC_ADD(pool->pending, 1);
+    ATOMIC_ADD(pool->queued, 1);
+    threadPoolPush(deque, job);
+
+    /*a sleeping group waiter may run the job as well as an idle worker*/
+    pthread_mutex_lock(&pool->mutex);
+    pthread_cond_signal(&pool->ready);
+    if (pool->waiting > 0) pthread_cond_broadcast(&pool->done);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static void *threadPoolWorker(void *argument)
+{
+    threadPoolDeque_t *own = (threadPoolDeque_t*) argument;
+    threadPool_t *pool = own->pool;
+    threadPoolJob_t job;
+
+    threadPoolOwn = own;
+    while(1)
+    {
+        if (threadPoolFind(own, &job))
+        {
+            threadPoolRun(pool, job);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->mutex);
+        while(ATOMIC_LOAD(pool->queued) == 0 && !pool->stop)
+        {
+            pthread_cond_wait(&pool->ready, &pool->mutex);
+        }
+        if (ATOMIC_LOAD(pool->queued) == 0 && pool->stop)
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            break;
+        }
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    threadPoolOwn = NULL;
+
+    return NULL;
+}
+
+/******************************************************************************
+ * threadPoolInit                                                             *
+ ******************************************************************************
+ * description: starts the worker threads of the pool.                        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPool_t *pool    : receives the pool address (e.g, &pool).       *
+ *      natural       threads : number of workers (0 means one per online     *
+ *                              processor).                                   *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a pool waiting for tasks.                     *
+ ******************************************************************************/
+void threadPoolInit(threadPool_t *pool, natural threads)
+{
+    register natural i;
+
+    if (threads == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (natural) online : 1;
+    }
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->ready, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->next    = 0;
+    pool->queued  = 0;
+    pool->pending = 0;
+    pool->waiting = 0;
+    pool->stop    = 0;
+    pool->size    = 0;
+    pool->threads = (pthread_t*) malloc(threads * sizeof(pthread_t));
+    pool->deques  = (threadPoolDeque_t*) malloc(threads * 
+                                                sizeof(threadPoolDeque_t));
+
+    for(i = 0; i < threads; i++)
+    {
+        pool->deques[i].pool     = pool;
+        pool->deques[i].capacity = 64;
+        pool->deques[i].jobs     = (threadPoolJob_t*) malloc(
+            pool->deques[i].capacity * sizeof(threadPoolJob_t));
+        pool->deques[i].first    = 0;
+        pool->deques[i].count    = 0;
+        pthread_mutex_init(&pool->deques[i].mutex, NULL);
+    }
+
+    /*the deques are all set before a worker may steal from them*/
+    for(i = 0; i < threads; i++)
+    {
+        if (pthread_create(&pool->threads[pool->size], NULL, threadPoolWorker,
+                           &pool->deques[pool->size]) != 0)
+        {
+            printf("ERROR::could only start %d of %d threads\n", pool->size,
+                   threads);
+            break;
+        }
+        __atomic_store_n(&pool->size, pool->size + 1, __ATOMIC_RELEASE);
+    }
+
+    /*deques without a worker are never dealt any job*/
+    for(; i < threads; i++)
+    {
+        pthread_mutex_destroy(&pool->deques[i].mutex);
+        free(pool->deques[i].jobs);
+    }
+}
+
+/******************************************************************************
+ * threadPoolDestroy                                                          *
+ ******************************************************************************
+ * description: lets the workers finish the queued tasks, then joins them.    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPool_t *pool    : receives the pool address (e.g, &pool).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a pool without threads.                       *
+ ******************************************************************************/
+void threadPoolDestroy(threadPool_t *pool)
+{
+    register natural i;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->ready);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for(i = 0; i < pool->size; i++) pthread_join(pool->threads[i], NULL);
+
+    for(i = 0; i < pool->size; i++)
+    {
+        pthread_mutex_destroy(&pool->deques[i].mutex);
+        free(pool->deques[i].jobs);
+    }
+
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->ready);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool->deques);
+    pool->threads = NULL;
+    pool->deques  = NULL;
+    pool->size    = 0;
+}
+
+/******************************************************************************
+ * threadPoolSize                                                             *
+ ******************************************************************************
+ * description: returns the number of worker threads.                         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPool_t *pool    : receives the pool address (e.g, &pool).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural               : number of workers.                            *
+ ******************************************************************************/
+natural threadPoolSize(const threadPool_t *pool)
+{
+    return pool->size;
+}
+
+/******************************************************************************
+ * threadPoolSubmit                                                           *
+ ******************************************************************************
+ * description: queues a task to be run by one of the workers: into the deque *
+ *              of the calling worker when called from a task, or else into   *
+ *              the deques in turn. Without any worker, the task is run right *
+ *              away by the caller.                                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPool_t     *pool     : receives the pool address (e.g, &pool).  *
+ *      threadPoolTask_t  task     : function to be run.                      *
+ *      void             *argument : passed along to the task.                *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                       : the task is queued.                      *
+ ******************************************************************************/
+void threadPoolSubmit(threadPool_t *pool, threadPoolTask_t task, 
+                      void *argument)
+{
+    threadPoolJob_t job;
+
+    if (pool->size == 0)
+    {
+        task(argument);
+        return ;
+    }
+
+    job.task     = task;
+    job.argument = argument;
+    job.group    = NULL;
+    threadPoolQueue(pool, job);
+}
+
+/******************************************************************************
+ * threadPoolWait                                                             *
+ ******************************************************************************
+ * description: blocks until every submitted task has finished, including the *
+ *              ones of other callers and of groups. It must not be called    *
+ *              from a task, which would wait for itself (threadPoolGroupWait *
+ *              can be).                                                      *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPool_t *pool    : receives the pool address (e.g, &pool).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : no task is queued or running.                 *
+ ******************************************************************************/
+void threadPoolWait(threadPool_t *pool)
+{
+    pthread_mutex_lock(&pool->mutex);
+    while(ATOMIC_LOAD(pool->pending) > 0) 
+    {
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/******************************************************************************
+ * threadPoolGroupInit                                                        *
+ ******************************************************************************
+ * description: initializes an empty task group on a pool. A group is a batch *
+ *              of tasks waited for together, and can be reused after a wait. *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPoolGroup_t *group : receives the group address (&group).       *
+ *      threadPool_t      *pool  : pool running the tasks of the group.       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : a group without tasks.                     *
+ ******************************************************************************/
+void threadPoolGroupInit(threadPoolGroup_t *group, threadPool_t *pool)
+{
+    group->pool    = pool;
+    group->pending = 0;
+}
+
+/******************************************************************************
+ * threadPoolGroupSubmit                                                      *
+ ******************************************************************************
+ * description: queues a task of a group, as threadPoolSubmit does.           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPoolGroup_t *group    : receives the group address (&group).    *
+ *      threadPoolTask_t   task     : function to be run.                     *
+ *      void              *argument : passed along to the task.               *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                        : the task is queued.                     *
+ ******************************************************************************/
+void threadPoolGroupSubmit(threadPoolGroup_t *group, threadPoolTask_t task,
+                           void *argument)
+{
+    threadPoolJob_t job;
+
+    if (group->pool->size == 0)
+    {
+        task(argument);
+        return ;
+    }
+
+    job.task     = task;
+    job.argument = argument;
+    job.group    = group;
+    ATOMIC_ADD(group->pending, 1);
+    threadPoolQueue(group->pool, job);
+}
+
+/******************************************************************************
+ * threadPoolGroupWait                                                        *
+ ******************************************************************************
+ * description: returns once every task of the group has finished. Meanwhile, *
+ *              the caller runs queued tasks (of any group), and only sleeps  *
+ *              when none is left, so it can be called from a task.           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      threadPoolGroup_t *group : receives the group address (&group).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                     : no task of the group is queued or running. *
+ ******************************************************************************/
+void threadPoolGroupWait(threadPoolGroup_t *group)
+{
+    threadPool_t *pool = group->pool;
+    threadPoolJob_t job;
+
+    while(ATOMIC_LOAD(group->pending) > 0)
+    {
+        if (threadPoolHelp(pool, &job))
+        {
+            threadPoolRun(pool, job);
+            continue;
+        }
+
+        /*the tasks left are running: sleeping until one ends or is queued*/
+        pthread_mutex_lock(&pool->mutex);
+        pool->waiting++;
+        while(ATOMIC_LOAD(group->pending) > 0 && ATOMIC_LOAD(pool->queued) == 0)
+        {
+            pthread_cond_wait(&pool->done, &pool->mutex);
+        }
+        pool->waiting--;
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                               THREAD POOL                                  *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * A fixed set of worker threads that run the submitted tasks. Tasks are      *
+ * joined by batch: the ones submitted to a task group are waited for with    *
+ * threadPoolGroupWait, which runs queued tasks while it waits. A group can   *
+ * be waited for from inside a task (a task joining its subtasks), and many   *
+ * threads can share a pool, each waiting for its own groups only.            *
+ *                                                                            *
+ * threadPoolWait waits for every task of the pool instead, whoever submitted *
+ * it: it must not be called from a task, which would wait for itself.        *
+ *                                                                            *
+ * Each worker owns a deque of tasks. Tasks submitted from outside the pool   *
+ * are dealt to the deques in turn, and the ones submitted by a task go to    *
+ * the deque of its own worker. A worker runs the newest task of its deque    *
+ * and, once it is empty, steals the oldest task of another one, so a worker  *
+ * that drew short tasks helps the others instead of going idle.              *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include "linkedList.h"
+
+#include <pthread.h>
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef void (*threadPoolTask_t)(void *argument);
+
+typedef struct threadPoolGroup
+{
+    struct threadPool *pool;
+    natural            pending;    /*tasks of the group queued or running*/
+
+} threadPoolGroup_t;
+
+typedef struct threadPoolJob
+{
+    threadPoolTask_t   task;
+    void              *argument;
+    threadPoolGroup_t *group;      /*NULL when submitted to the pool*/
+
+} threadPoolJob_t;
+
+typedef struct threadPoolDeque
+{
+    struct threadPool *pool;
+    pthread_mutex_t    mutex;
+    threadPoolJob_t   *jobs;       /*circular buffer*/
+    natural            capacity;
+    natural            first;      /*oldest job, the one stolen*/
+    natural            count;
+
+} threadPoolDeque_t;
+
+typedef struct threadPool
+{
+    pthread_t         *threads;
+    natural            size;
+    threadPoolDeque_t *deques;     /*one per worker*/
+    natural            next;       /*deque of the next outside submission*/
+    pthread_mutex_t    mutex;
+    pthread_cond_t     ready;      /*a job was submitted, or the pool stops*/
+    pthread_cond_t     done;       /*a pool or group is done, or a job was
+                                     submitted while a group waiter slept*/
+    natural            queued;     /*jobs in the deques*/
+    natural            pending;    /*jobs queued or running*/
+    natural            waiting;    /*group waiters asleep on done*/
+    int                stop;
+
+} threadPool_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void threadPoolInit(threadPool_t *pool, natural threads);
+void threadPoolDestroy(threadPool_t *pool);
+natural threadPoolSize(const threadPool_t *pool);
+void threadPoolSubmit(threadPool_t *pool, threadPoolTask_t task, 
+                      void *argument);
+void threadPoolWait(threadPool_t *pool);
+void threadPoolGroupInit(threadPoolGroup_t *group, threadPool_t *pool);
+void threadPoolGroupSubmit(threadPoolGroup_t *group, threadPoolTask_t task,
+                           void *argument);
+void threadPoolGroupWait(threadPoolGroup_t *group);
+
+#endif
+/*****END*****/
@@ -0,0 +1,426 @@
+/******************************************************************************
+ *                          UNROLLED LINKED LISTS                             *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "unrolledList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UNROLLED_LIST_HALF (UNROLLED_LIST_CAPACITY / 2)
+
+static unrolledListNode_t *unrolledListNodeNew(void)
+{
+    /*the size of a node is a multiple of its 64 bytes alignment*/
+    unrolledListNode_t *node = (unrolledListNode_t*) 
+        aligned_alloc(_Alignof(unrolledListNode_t), sizeof(unrolledListNode_t));
+    node->next  = NULL;
+    node->count = 0;
+
+    return node;
+}
+
+/*Finds the node holding the value at index, its predecessor and the position
+  of the value inside the node. The index must be smaller than the size.*/
+static unrolledListNode_t *unrolledListLocate(const unrolledList_t *list, 
+                                              natural index, 
+                                              unrolledListNode_t **previous,
+                                              natural *offset)
+{
+    unrolledListNode_t *current = list->head;
+    unrolledListNode_t *before  = NULL;
+
+    while(index >= current->count)
+    {
+        index  -= current->count;
+        before  = current;
+        current = current->next;
+    }
+
+    if (previous != NULL) *previous = before;
+    *offset = index;
+
+    return current;
+}
+
+/*Moves the upper half of a full node into a new node, right after it*/
+static void unrolledListSplit(unrolledList_t *list, unrolledListNode_t *node)
+{
+    unrolledListNode_t *half = unrolledListNodeNew();
+
+    half->count = node->count - UNROLLED_LIST_HALF;
+    memcpy(half->data, node->data + UNROLLED_LIST_HALF, 
+           half->count * sizeof(real));
+    node->count = UNROLLED_LIST_HALF;
+
+    half->next = node->next;
+    node->next = half;
+    if (list->tail == node) list->tail = half;
+}
+
+/*Unlinks and frees an empty node*/
+static void unrolledListUnlink(unrolledList_t *list, unrolledListNode_t *node,
+                               unrolledListNode_t *previous)
+{
+    if (previous == NULL) list->head = node->next;
+    else                  previous->next = node->next;
+
+    if (list->tail == node) list->tail = previous;
+
+    free(node);
+}
+
+/*Keeps a node at least half full, by merging it with the next node or by 
+  borrowing values from it*/
+static void unrolledListRebalance(unrolledList_t *list, 
+                                  unrolledListNode_t *node,
+                                  unrolledListNode_t *previous)
+{
+    unrolledListNode_t *nextNode = node->next;
+
+    if (node->count == 0)
+    {
+        unrolledListUnlink(list, node, previous);
+        return ;
+    }
+    if (node->count >= UNROLLED_LIST_HALF || nextNode == NULL) return ;
+
+    if (node->count + nextNode->count <= UNROLLED_LIST_CAPACITY)
+    {
+        /*merging the next node into this one*/
+        memcpy(node->data + node->count, nextNode->data, 
+               nextNode->count * sizeof(real));
+        node->count += nextNode->count;
+        unrolledListUnlink(list, nextNode, node);
+    }
+    else
+    {
+        /*borrowing values from the next node until this one is half full*/
+        natural moved = UNROLLED_LIST_HALF - node->count;
+        memcpy(node->data + node->count, nextNode->data, moved * sizeof(real));
+        memmove(nextNode->data, nextNode->data + moved, 
+                (nextNode->count - moved) * sizeof(real));
+        node->count     += moved;
+        nextNode->count -= moved;
+    }
+}
+
+/******************************************************************************
+ * unrolledListInit                                                           *
+ ******************************************************************************
+ * description: initializes an empty unrolled list.                           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void unrolledListInit(unrolledList_t *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/******************************************************************************
+ * unrolledListFree                                                           *
+ ******************************************************************************
+ * description: frees every node of the list and leaves it empty.             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void unrolledListFree(unrolledList_t *list)
+{
+    unrolledListNode_t *current = list->head;
+    unrolledListNode_t *nextNode = NULL;
+
+    while(current != NULL)
+    {
+        nextNode = current->next;
+        free(current);
+        current = nextNode;
+    }
+
+    unrolledListInit(list);
+}
+
+/******************************************************************************
+ * unrolledListSize                                                           *
+ ******************************************************************************
+ * description: returns the number of values in the list.                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural               : number of values in the list.                 *
+ ******************************************************************************/
+natural unrolledListSize(const unrolledList_t *list)
+{
+    return list->size;
+}
+
+/******************************************************************************
+ * unrolledListAddBegin                                                       *
+ ******************************************************************************
+ * description: adds a new value at the beginning of the list.                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the beginning of the list.     *
+ ******************************************************************************/
+void unrolledListAddBegin(unrolledList_t *list, real data)
+{
+    unrolledListAddByIndex(list, data, 0);
+}
+
+/******************************************************************************
+ * unrolledListAddEnd                                                         *
+ ******************************************************************************
+ * description: adds a new value at the end of the list, in O(1). When the    *
+ *              last node is full, a new node is started, so a list built by  *
+ *              appending has all its nodes full.                             *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the end of the list.           *
+ ******************************************************************************/
+void unrolledListAddEnd(unrolledList_t *list, real data)
+{
+    if (list->tail == NULL || list->tail->count == UNROLLED_LIST_CAPACITY)
+    {
+        unrolledListNode_t *node = unrolledListNodeNew();
+
+        if (list->tail == NULL) list->head = node;
+        else                    list->tail->next = node;
+        list->tail = node;
+    }
+
+    list->tail->data[list->tail->count++] = data;
+    list->size++;
+}
+
+/******************************************************************************
+ * unrolledListAddByIndex                                                     *
+ ******************************************************************************
+ * description: adds a new value at some specific position of the list. An   *
+ *              index beyond the last position appends the value. A full node *
+ *              is split before the value is inserted into it.                *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : unsigned int index value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void unrolledListAddByIndex(unrolledList_t *list, real data, natural index)
+{
+    if (index >= list->size)
+    {
+        unrolledListAddEnd(list, data);
+        return ;
+    }
+
+    natural offset;
+    unrolledListNode_t *node = unrolledListLocate(list, index, NULL, &offset);
+
+    if (node->count == UNROLLED_LIST_CAPACITY)
+    {
+        unrolledListSplit(list, node);
+        if (offset > UNROLLED_LIST_HALF)
+        {
+            offset -= UNROLLED_LIST_HALF;
+            node    = node->next;
+        }
+    }
+
+    /*opening a slot for the new value*/
+    memmove(node->data + offset + 1, node->data + offset, 
+            (node->count - offset) * sizeof(real));
+    node->data[offset] = data;
+    node->count++;
+    list->size++;
+}
+
+/******************************************************************************
+ * unrolledListRemoveLast                                                     *
+ ******************************************************************************
+ * description: removes the last value of the list. Only when the last node   *
+ *              becomes empty, its predecessor has to be found.               *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the last value.                *
+ ******************************************************************************/
+void unrolledListRemoveLast(unrolledList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    list->size--;
+    if (--list->tail->count > 0) return ;
+
+    unrolledListNode_t *previous = NULL;
+    if (list->head != list->tail)
+    {
+        previous = list->head;
+        while(previous->next != list->tail) previous = previous->next;
+    }
+    unrolledListUnlink(list, list->tail, previous);
+}
+
+/******************************************************************************
+ * unrolledListRemoveFirst                                                    *
+ ******************************************************************************
+ * description: removes the first value of the list.                          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the first value.               *
+ ******************************************************************************/
+void unrolledListRemoveFirst(unrolledList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    unrolledListRemoveByIndex(list, 0);
+}
+
+/******************************************************************************
+ * unrolledListRemoveByIndex                                                  *
+ ******************************************************************************
+ * description: removes a value at a specific position. Indexes beyond the    *
+ *              last position are ignored.                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the value at the desired       *
+ *                              position.                                     *
+ ******************************************************************************/
+void unrolledListRemoveByIndex(unrolledList_t *list, natural index)
+{
+    if (index >= list->size) return ;
+
+    natural offset;
+    unrolledListNode_t *previous;
+    unrolledListNode_t *node = unrolledListLocate(list, index, &previous, 
+                                                  &offset);
+
+    /*closing the slot of the removed value*/
+    memmove(node->data + offset, node->data + offset + 1, 
+            (node->count - offset - 1) * sizeof(real));
+    node->count--;
+    list->size--;
+
+    unrolledListRebalance(list, node, previous);
+}
+
+/******************************************************************************
+ * unrolledListSet                                                            *
+ ******************************************************************************
+ * description: sets a new value at the desired position of the list.         *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void unrolledListSet(unrolledList_t *list, real data, natural index)
+{
+    if (index >= list->size) return ;
+
+    natural offset;
+    unrolledListNode_t *node = unrolledListLocate(list, index, NULL, &offset);
+    node->data[offset] = data;
+}
+
+/******************************************************************************
+ * unrolledListGet                                                            *
+ ******************************************************************************
+ * description: gets the value at the desired position of the list.           *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : value at the desired position (-1 and an      *
+ *                              error message if there is no such value).     *
+ ******************************************************************************/
+real unrolledListGet(const unrolledList_t *list, natural index)
+{
+    if (index >= list->size)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    natural offset;
+    unrolledListNode_t *node = unrolledListLocate(list, index, NULL, &offset);
+
+    return node->data[offset];
+}
+
+/******************************************************************************
+ * unrolledListTransverse                                                     *
+ ******************************************************************************
+ * description: prints the list on the terminal screen.                       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      unrolledList_t *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : printed list on the terminal screen.          *
+ ******************************************************************************/
+void unrolledListTransverse(const unrolledList_t *list)
+{
+    unrolledListNode_t *current = list->head;
+    register natural i;
+
+    printf("unrolledList::[");
+    while(current != NULL)
+    {
+        for(i = 0; i < current->count; i++)
+        {
+            printf(" %1.1f", current->data[i]);
+        }
+        current = current->next;
+    }
+    printf(" ]\n");
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+ *                          UNROLLED LINKED LISTS                             *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               * 
+ *                                                                            *
+ * This is an unrolled linked list: each node holds a block of values and the *
+ * number of values in use, packed into two cache lines (14 doubles). A walk  *
+ * through the list follows one pointer every 14 values, instead of one per   *
+ * value, and the values of a node are contiguous in memory.                  *
+ *                                                                            *
+ * A full node is split in two halves when a value is inserted into it, and a *
+ * node that becomes less than half full borrows values from, or is merged    *
+ * with, the next node. The functions are the same ones of linkedList.h, but  *
+ * the list is always owned by an unrolledList_t, which keeps the head, the   *
+ * tail and the number of values.                                             *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __UNROLLED_LIST_H__
+#define __UNROLLED_LIST_H__
+
+#include "linkedList.h"
+
+/*Number of values per node: with next and count, two 64 bytes cache lines*/
+#define UNROLLED_LIST_CAPACITY 14
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+/*next and count share the first cache line with the first 6 values, and the
+  other 8 values fill the second one: a node is 128 bytes, with no padding
+  but 4 bytes after count, allocated on a 64 bytes boundary*/
+typedef struct unrolledListNode
+{
+    struct unrolledListNode *next;
+    natural                  count;
+    real                     data[UNROLLED_LIST_CAPACITY];
+
+} __attribute__((aligned(64))) unrolledListNode_t;
+
+typedef struct unrolledList
+{
+    unrolledListNode_t *head;
+    unrolledListNode_t *tail;
+    natural             size;
+
+} unrolledList_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void unrolledListInit(unrolledList_t *list);
+void unrolledListFree(unrolledList_t *list);
+natural unrolledListSize(const unrolledList_t *list);
+void unrolledListAddBegin(unrolledList_t *list, real data);
+void unrolledListAddEnd(unrolledList_t *list, real data);
+void unrolledListAddByIndex(unrolledList_t *list, real data, natural index);
+void unrolledListRemoveLast(unrolledList_t *list);
+void unrolledListRemoveFirst(unrolledList_t *list);
+void unrolledListRemoveByIndex(unrolledList_t *list, natural index);
+void unrolledListSet(unrolledList_t *list, real data, natural index);
+real unrolledListGet(const unrolledList_t *list, natural index);
+void unrolledListTransverse(const unrolledList_t *list);
+
+#endif
+/*****END*****/
@@ -0,0 +1,360 @@
+/******************************************************************************
+ *                            XOR LINKED LISTS                                *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************/
+
+#include "xorList.h"
+
+#include <stdio.h>
+
+/*Nodes carved from each chunk of the pool*/
+#define XOR_LIST_CHUNK 1024
+
+/*The neighbour of node on the other side of known*/
+static xorListNode_t *xorListOther(const xorListNode_t *node,
+                                   const xorListNode_t *known)
+{
+    return (xorListNode_t*) (node->link ^ (uintptr_t) known);
+}
+
+/*Replaces the neighbour from of node by to*/
+static void xorListRelink(xorListNode_t *node, const xorListNode_t *from,
+                          const xorListNode_t *to)
+{
+    if (node != NULL) node->link ^= (uintptr_t) from ^ (uintptr_t) to;
+}
+
+/*Finds the node at index and the node before it, from the nearest end*/
+static xorListNode_t *xorListSeek(const xorList_t *list, natural index,
+                                  xorListNode_t **previous)
+{
+    xorListNode_t *current, *other, *step;
+    register natural i;
+
+    if (index < list->size / 2)
+    {
+        other   = NULL;
+        current = list->head;
+        for(i = 0; i < index; i++)
+        {
+            step    = xorListOther(current, other);
+            other   = current;
+            current = step;
+        }
+        *previous = other;
+    }
+    else
+    {
+        /*walking backwards, other is the node after current*/
+        other   = NULL;
+        current = list->tail;
+        for(i = list->size - 1; i > index; i--)
+        {
+            step    = xorListOther(current, other);
+            other   = current;
+            current = step;
+        }
+        *previous = xorListOther(current, other);
+    }
+
+    return current;
+}
+
+static xorListNode_t *xorListNodeNew(xorList_t *list, real data,
+                                     xorListNode_t *previous,
+                                     xorListNode_t *next)
+{
+    xorListNode_t *node = (xorListNode_t*) linkedListPoolAlloc(&list->pool);
+
+    node->data = data;
+    node->link = (uintptr_t) previous ^ (uintptr_t) next;
+    list->size++;
+
+    return node;
+}
+
+/*Unlinks node, found between previous and next*/
+static void xorListUnlink(xorList_t *list, xorListNode_t *previous,
+                          xorListNode_t *node, xorListNode_t *next)
+{
+    xorListRelink(previous, node, next);
+    xorListRelink(next, node, previous);
+
+    if (previous == NULL) list->head = next;
+    if (next == NULL)     list->tail = previous;
+
+    linkedListPoolRelease(&list->pool, node);
+    list->size--;
+}
+
+/******************************************************************************
+ * xorListInit                                                                *
+ ******************************************************************************
+ * description: initializes an empty list and its node pool.                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void xorListInit(xorList_t *list)
+{
+    linkedListPoolInitSized(&list->pool, sizeof(xorListNode_t), XOR_LIST_CHUNK);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/******************************************************************************
+ * xorListFree                                                                *
+ ******************************************************************************
+ * description: frees every node of the list, by giving its pool back at      *
+ *              once, and leaves it empty.                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : an empty list.                                *
+ ******************************************************************************/
+void xorListFree(xorList_t *list)
+{
+    linkedListPoolDestroy(&list->pool);
+    xorListInit(list);
+}
+
+/******************************************************************************
+ * xorListSize                                                                *
+ ******************************************************************************
+ * description: returns the number of values in the list.                     *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      natural               : number of values in the list.                 *
+ ******************************************************************************/
+natural xorListSize(const xorList_t *list)
+{
+    return list->size;
+}
+
+/******************************************************************************
+ * xorListAddBegin                                                            *
+ ******************************************************************************
+ * description: adds a new node at the beginning of the list, in O(1).        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the beginning of the list.      *
+ ******************************************************************************/
+void xorListAddBegin(xorList_t *list, real data)
+{
+    xorListNode_t *node = xorListNodeNew(list, data, NULL, list->head);
+
+    xorListRelink(list->head, NULL, node);
+    if (list->tail == NULL) list->tail = node;
+    list->head = node;
+}
+
+/******************************************************************************
+ * xorListAddEnd                                                              *
+ ******************************************************************************
+ * description: adds a new node at the end of the list, in O(1).              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the end of the list.            *
+ ******************************************************************************/
+void xorListAddEnd(xorList_t *list, real data)
+{
+    xorListNode_t *node = xorListNodeNew(list, data, list->tail, NULL);
+
+    xorListRelink(list->tail, NULL, node);
+    if (list->head == NULL) list->head = node;
+    list->tail = node;
+}
+
+/******************************************************************************
+ * xorListAddByIndex                                                          *
+ ******************************************************************************
+ * description: adds a new node at some specific position of the list. An    *
+ *              index beyond the last position appends the node.              *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : unsigned int index value.                     *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new node at the desired position.           *
+ ******************************************************************************/
+void xorListAddByIndex(xorList_t *list, real data, natural index)
+{
+    xorListNode_t *previous, *next, *node;
+
+    if (index == 0)          { xorListAddBegin(list, data); return ; }
+    if (index >= list->size) { xorListAddEnd(list, data);   return ; }
+
+    next = xorListSeek(list, index, &previous);
+    node = xorListNodeNew(list, data, previous, next);
+    xorListRelink(previous, next, node);
+    xorListRelink(next, previous, node);
+}
+
+/******************************************************************************
+ * xorListRemoveLast                                                          *
+ ******************************************************************************
+ * description: removes the last node of the list, in O(1).                   *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the last node.                 *
+ ******************************************************************************/
+void xorListRemoveLast(xorList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    xorListUnlink(list, xorListOther(list->tail, NULL), list->tail, NULL);
+}
+
+/******************************************************************************
+ * xorListRemoveFirst                                                         *
+ ******************************************************************************
+ * description: removes the first node of the list, in O(1).                  *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the first node.                *
+ ******************************************************************************/
+void xorListRemoveFirst(xorList_t *list)
+{
+    if (list->size == 0)
+    {
+        printf("ERROR::list is empty\n");
+        return ;
+    }
+
+    xorListUnlink(list, NULL, list->head, xorListOther(list->head, NULL));
+}
+
+/******************************************************************************
+ * xorListRemoveByIndex                                                       *
+ ******************************************************************************
+ * description: removes a node at a specific position. Indexes beyond the     *
+ *              last position are ignored.                                    *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a list without the node at the desired        *
+ *                              position.                                     *
+ ******************************************************************************/
+void xorListRemoveByIndex(xorList_t *list, natural index)
+{
+    xorListNode_t *previous, *node;
+
+    if (index >= list->size) return ;
+
+    node = xorListSeek(list, index, &previous);
+    xorListUnlink(list, previous, node, xorListOther(node, previous));
+}
+
+/******************************************************************************
+ * xorListSet                                                                 *
+ ******************************************************************************
+ * description: sets a new value at the desired position of the list.        *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      real            data  : a double data value.                          *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : a new value at the desired position.          *
+ ******************************************************************************/
+void xorListSet(xorList_t *list, real data, natural index)
+{
+    xorListNode_t *previous;
+
+    if (index >= list->size) return ;
+
+    xorListSeek(list, index, &previous)->data = data;
+}
+
+/******************************************************************************
+ * xorListGet                                                                 *
+ ******************************************************************************
+ * description: gets the value at the desired position of the list.          *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *      natural         index : desired position in the list.                 *
+ *                                                                            *
+ * output:                                                                    *
+ *      real                  : value at the desired position (-1 and an      *
+ *                              error message if there is no such value).     *
+ ******************************************************************************/
+real xorListGet(const xorList_t *list, natural index)
+{
+    xorListNode_t *previous;
+
+    if (index >= list->size)
+    {
+        printf("ERROR::There is no data or node for index %d\n", index);
+        return -1;
+    }
+
+    return xorListSeek(list, index, &previous)->data;
+}
+
+/******************************************************************************
+ * xorListTransverse                                                          *
+ ******************************************************************************
+ * description: prints the list on the terminal screen.                       *
+ ******************************************************************************
+ * parameters:                                                                *
+ *      xorList_t      *list  : receives the list address (e.g, &list).       *
+ *                                                                            *
+ * output:                                                                    *
+ *      void                  : printed list on the terminal screen.          *
+ ******************************************************************************/
+void xorListTransverse(const xorList_t *list)
+{
+    xorListNode_t *previous = NULL;
+    xorListNode_t *current = list->head;
+    xorListNode_t *next;
+
+    printf("xorList::[");
+    while(current != NULL)
+    {
+        printf(" %1.1f", current->data);
+        next     = xorListOther(current, previous);
+        previous = current;
+        current  = next;
+    }
+    printf(" ]\n");
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *                            XOR LINKED LISTS                                *
+ ******************************************************************************
+ * Author: Almério José Venâncio Pains Soares                                 *
+ * E-mail: almeriopamplona@gmail.com                                          *
+ ******************************************************************************
+ * Creation:     17.10.2026                                                   *
+ * Modification: 17.10.2026                                                   *
+ ******************************************************************************
+ * Description:                                                               *
+ *                                                                            *
+ * This is a XOR linked list: each node keeps a single word, the XOR of the   *
+ * addresses of its previous and next nodes (NULL counting as 0). Knowing one *
+ * neighbour gives the other, so the list can be walked both ways from either *
+ * end, while the nodes are as small as the ones of a linkedList_t (16 bytes  *
+ * against 32 for a doublyList_t node).                                       *
+ *                                                                            *
+ * Adding and removing at both ends are O(1), and the index-based functions   *
+ * walk from the nearest end. A node can not be removed from its address      *
+ * alone, since one of its neighbours must be known as well.                  *
+ *                                                                            *
+ * The functions are the same ones of linkedList.h, and the nodes come from a *
+ * pool owned by the list (linkedListPool.h).                                 *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef __XOR_LIST_H__
+#define __XOR_LIST_H__
+
+#include "linkedList.h"
+#include "linkedListPool.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * DATA TYPE DEFINITION                                                       *
+ ******************************************************************************/
+typedef struct xorListNode
+{
+    real      data;
+    uintptr_t link;     /*previous XOR next*/
+
+} xorListNode_t;
+
+typedef struct xorList
+{
+    xorListNode_t    *head;
+    xorListNode_t    *tail;
+    natural           size;
+    linkedListPool_t  pool;
+
+} xorList_t;
+
+/******************************************************************************
+ * HANDLE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+void xorListInit(xorList_t *list);
+void xorListFree(xorList_t *list);
+natural xorListSize(const xorList_t *list);
+void xorListAddBegin(xorList_t *list, real data);
+void xorListAddEnd(xorList_t *list, real data);
+void xorListAddByIndex(xorList_t *list, real data, natural index);
+void xorListRemoveLast(xorList_t *list);
+void xorListRemoveFirst(xorList_t *list);
+void xorListRemoveByIndex(xorList_t *list, natural index);
+void xorListSet(xorList_t *list, real data, natural index);
+real xorListGet(const xorList_t *list, natural index);
+void xorListTransverse(const xorList_t *list);
+
+#endif
+/*****END*****/